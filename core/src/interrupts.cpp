@@ -12,9 +12,25 @@ extern "C"
     {
         Dispatcher<InterruptSource::eUSART1>::Call();
     }
+    void TIM1_CC_IRQHandler(void)
+    {
+        Dispatcher<InterruptSource::eTIM1_CC>::Call();
+    }
+    void TIM2_IRQHandler(void)
+    {
+        Dispatcher<InterruptSource::eTIM2>::Call();
+    }
+    void SPI1_IRQHandler(void)
+    {
+        Dispatcher<InterruptSource::eSPI1>::Call();
+    }
     void EXTI15_10_IRQHandler(void)
     {
     }
+    void DMA1_Channel1_IRQHandler(void)
+    {
+        Dispatcher<InterruptSource::eDMA1_Channel1>::Call();
+    }
     void DMA1_Channel4_IRQHandler(void)
     {
         Dispatcher<InterruptSource::eDMA1_Channel4>::Call();
@@ -16,14 +16,16 @@ int main()
 {
     __NVIC_SetPriorityGrouping(3_u32);
 
-    //printf_("\n");
-    //printf_("System Clock: %ihz\n", (int)SystemBus_t::CoreClock());
-    //printf_("AHB Clock: %ihz\n", (int)SystemBus_t::AHB_Clock());
-    //printf_("APB2 Clock: %ihz\n", (int)SystemBus_t::APB2_Clock());
-    //printf_("APB1 Clock: %ihz\n", (int)SystemBus_t::APB1_Clock());
+    printf_("\n");
+    printf_("System Clock: %ihz\n", (int)SystemBus_t::SystemClockFreq());
+    printf_("AHB Clock: %ihz\n", (int)SystemBus_t::AHB_ClockFreq());
+    printf_("APB2 Clock: %ihz\n", (int)SystemBus_t::APB2_ClockFreq());
+    printf_("APB1 Clock: %ihz\n", (int)SystemBus_t::APB1_ClockFreq());
 
     while (1) 
     {
+        ppcm.Poll();
+
         if ((ppcm.Ticks() - timer) >= 5_sec)
         {
             /*switch(led_state)
@@ -41,8 +43,8 @@ int main()
     return 0;
 }
 
+// Main loop only, interrupts print through a LineOutput of their own
 void putchar_(char c)
 {
-    //auto& serial = serial_t::instance();
-    //serial.Write(c);
+    ppcm.Console().Put(c);
 }
\ No newline at end of file
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "macros.h"
+#include "types.hpp"
+#include "constants.hpp"
+#include "sample.hpp"
+#include "statistics.hpp"
+#include "capture.hpp"
+#include "stream.hpp"
+
+#include "mcu/adc.hpp"
+#include "mcu/tim.hpp"
+#include "mcu/cycle_counter.hpp"
+#include "common/atomic.hpp"
+#include "common/math.hpp"
+#include "common/dsp/biquad.hpp"
+#include "common/dsp/cic.hpp"
+#include "common/dsp/fir.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace System
+{
+    enum class AcquisitionMode : uint8_t
+    {
+        Filtered = 0,               // Notch and low-pass at the ADC rate
+        Oversampled,                // CIC decimation, more bits at a lower rate
+        OversampledCompensated      // CIC decimation followed by the droop compensator
+    };
+
+    struct ProcessingTime
+    {
+        uint32_t Cycles{ 0 };       // Core cycles for the last block, all channels
+        uint32_t MaxCycles{ 0 };
+        uint32_t Samples{ 0 };      // Samples in that block, all channels
+    };
+
+    // Hand-off point between the ADC path and its consumers. A published sample is two words per resolution, it is
+    // written and copied out with interrupts masked so no reader sees half of an update.
+    class Acquisition
+    {
+    private:
+        static auto & Source() noexcept
+        {
+            static auto source{ MCU::ADC::Module{ AcquisitionProperties{}, Common::Bound<&ProcessBlock>{} } };
+            return source;
+        }
+        static auto & Pace() noexcept
+        {
+            static MCU::TIM::TriggerOutput<AcquisitionTimer> pace{};
+            return pace;
+        }
+
+    public:
+        static constexpr std::size_t ChannelCount = 2u;
+        static constexpr std::size_t BlockSize = Constants::AcquisitionBlockSize;
+
+        using q31_t = Common::DSP::q31_t;
+        using RawBlock = Common::Containers::Span<uint16_t const>;
+        using Block = std::array<std::array<q31_t, BlockSize>, ChannelCount>;
+        using Filter = Common::DSP::BiquadCascade<2u, ChannelCount>;
+        using Decimator = Common::DSP::CICDecimator<Constants::DecimatorOrder, Constants::OversampleRatio, ChannelCount>;
+        using Compensator = Common::DSP::FIR<3u, ChannelCount>;
+
+        // Fractional code bits carried by LatestFine(), what oversampling buys shows up here
+        static constexpr unsigned FineBits = Constants::SampleFineBits;
+        static constexpr uint32_t DecimatedRate = Constants::SampleRate / Constants::OversampleRatio;
+
+        static_assert(Decimator::GainBits >= FineBits, "Decimator gain is too small for the fine sample resolution.");
+
+        // Blocks arrive from the DMA interrupt once the pacing timer runs
+        Acquisition() noexcept
+        {
+            MCU::TRACE::CycleCounter::Enable();
+
+            (void)Source();
+            Pace().Start();
+        }
+        ~Acquisition() noexcept
+        {
+            Pace().Stop();
+        }
+
+        ALWAYS_INLINE
+        static void Publish(Sample const & fine) noexcept
+        {
+            Sample const latest{ (fine.Voltage >> FineBits), (fine.Current >> FineBits) };
+
+            Common::CriticalSection const lock{};
+            s_fine = fine;
+            s_latest = latest;
+        }
+        // Whole ADC codes
+        ALWAYS_INLINE
+        static Sample Latest() noexcept
+        {
+            Common::CriticalSection const lock{};
+            return s_latest;
+        }
+        // ADC codes with FineBits fractional bits
+        ALWAYS_INLINE
+        static Sample LatestFine() noexcept
+        {
+            Common::CriticalSection const lock{};
+            return s_fine;
+        }
+        // Whole ADC codes of the last conversion, unfiltered and a block earlier than Latest(). For the control loop.
+        static Sample Newest() noexcept
+        {
+            auto const sequence{ std::remove_reference_t<decltype(Source())>::Newest() };
+            return Sample{ int32_t{ sequence[0] }, int32_t{ sequence[1] } };
+        }
+        // Takes effect at the start of the next block, the new path starts from cleared state
+        static void SetMode(AcquisitionMode const mode) noexcept
+        {
+            s_requested = mode;
+        }
+        static AcquisitionMode Mode() noexcept
+        {
+            return s_mode;
+        }
+        // Samples per second per channel of the active path
+        static uint32_t OutputRate() noexcept
+        {
+            return (s_mode == AcquisitionMode::Filtered) ? Constants::SampleRate : DecimatedRate;
+        }
+        // Called from the DMA half/complete transfer interrupt with the half buffer that just filled,
+        // raw ADC codes interleaved as voltage, current, voltage, ...
+        static void ProcessBlock(RawBlock raw) noexcept
+        {
+            uint32_t const start{ MCU::TRACE::CycleCounter::Now() };
+            std::size_t const count{ Common::Math::Minimum(raw.size() / ChannelCount, BlockSize) };
+
+            if (s_requested != s_mode)
+            {
+                s_mode = s_requested;
+                ResetState();
+            }
+
+            std::size_t const produced{ (s_mode == AcquisitionMode::Filtered) ? FilterBlock(raw, count) : DecimateBlock(raw, count) };
+
+            if (produced != 0u)
+            {
+                Publish(Sample{ s_block[0][produced - 1u], s_block[1][produced - 1u] });
+            }
+            for (std::size_t ch = 0; ch < ChannelCount; ++ch)
+            {
+                Statistics::Update(ch, Statistics::Block{ s_block[ch].data(), produced });
+            }
+            Capture::Record(Capture::Block{ s_block[0].data(), produced }, Capture::Block{ s_block[1].data(), produced }, OutputRate());
+            Stream::Record(Capture::Block{ s_block[0].data(), produced }, Capture::Block{ s_block[1].data(), produced }, Common::Tools::EnumValue(s_mode));
+
+            uint32_t const cycles{ MCU::TRACE::CycleCounter::Since(start) };
+            s_time.Cycles = cycles;
+            s_time.MaxCycles = Common::Math::Maximum(s_time.MaxCycles, cycles);
+            s_time.Samples = static_cast<uint32_t>(count * ChannelCount);
+        }
+        static ProcessingTime Time() noexcept
+        {
+            Common::CriticalSection const lock{};
+            return s_time;
+        }
+        static void Reset() noexcept
+        {
+            ResetState();
+            s_time = ProcessingTime{};
+        }
+
+    private:
+        // 16 bit codes land at half scale, the filter needs one bit of headroom
+        static constexpr unsigned CodeShift = 14u;
+        static constexpr int32_t CodeMidScale = 0x8000;
+
+        static void ResetState() noexcept
+        {
+            s_filter.Reset();
+            s_decimator.Reset();
+            s_compensator.Reset();
+        }
+        // Both paths leave their output in s_block in fine units and return how many samples per channel they produced
+        static std::size_t FilterBlock(RawBlock raw, std::size_t const count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                s_block[0][i] = ToQ31(raw[(i * ChannelCount) + 0u]);
+                s_block[1][i] = ToQ31(raw[(i * ChannelCount) + 1u]);
+            }
+            for (std::size_t ch = 0; ch < ChannelCount; ++ch)
+            {
+                s_filter.Process(ch, Common::Containers::Span<q31_t>{ s_block[ch].data(), count });
+                for (std::size_t i = 0; i < count; ++i) { s_block[ch][i] = FromQ31(s_block[ch][i]); }
+            }
+            return count;
+        }
+        // Codes are made signed around mid scale first so the decimator's bit growth is counted from 16 bits
+        static std::size_t DecimateBlock(RawBlock raw, std::size_t const count) noexcept
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                s_block[0][i] = int32_t{ raw[(i * ChannelCount) + 0u] } - CodeMidScale;
+                s_block[1][i] = int32_t{ raw[(i * ChannelCount) + 1u] } - CodeMidScale;
+            }
+
+            std::size_t produced{ 0 };
+            for (std::size_t ch = 0; ch < ChannelCount; ++ch)
+            {
+                produced = s_decimator.Process(ch, Common::Containers::Span<int32_t>{ s_block[ch].data(), count });
+
+                if ((s_mode == AcquisitionMode::OversampledCompensated) && (produced != 0u))
+                {
+                    s_compensator.Process(ch, Common::Containers::Span<int32_t>{ s_block[ch].data(), produced });
+                }
+                for (std::size_t i = 0; i < produced; ++i) { s_block[ch][i] = FromDecimated(s_block[ch][i]); }
+            }
+            return produced;
+        }
+
+        ALWAYS_INLINE
+        static q31_t ToQ31(uint16_t const code) noexcept
+        {
+            return static_cast<q31_t>(uint32_t{ code } << CodeShift);
+        }
+        ALWAYS_INLINE
+        static int32_t FromQ31(q31_t const value) noexcept
+        {
+            return (value >> (CodeShift - FineBits));
+        }
+        ALWAYS_INLINE
+        static int32_t FromDecimated(int32_t const value) noexcept
+        {
+            return (value >> (Decimator::GainBits - FineBits)) + (CodeMidScale << FineBits);
+        }
+
+        static constexpr Filter::Coefficients s_coefficients
+        {
+            Common::DSP::Design::Notch(Constants::SampleRate, Constants::MainsFrequency),
+            Common::DSP::Design::LowPass(Constants::SampleRate, Constants::AcquisitionCorner)
+        };
+
+        static constexpr Compensator::Coefficients s_compensation
+        {
+            Common::DSP::Design::CICCompensator<Constants::DecimatorOrder, Constants::OversampleRatio, Compensator::FracBits>()
+        };
+
+        inline static Sample s_latest{};
+        inline static Sample s_fine{};
+        inline static Block s_block{};
+        inline static Filter s_filter{ s_coefficients };
+        inline static Decimator s_decimator{};
+        inline static Compensator s_compensator{ s_compensation };
+        inline static AcquisitionMode volatile s_requested{ AcquisitionMode::Filtered };
+        inline static AcquisitionMode volatile s_mode{ AcquisitionMode::Filtered };
+        inline static ProcessingTime s_time{};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "macros.h"
+#include "constants.hpp"
+#include "sample.hpp"
+
+#include "common/math.hpp"
+#include "common/containers/span.hpp"
+
+#include "stm32f1xx.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Bounds of the RAM the linker script leaves over between .bss and the heap/stack reservation
+extern "C" uint32_t _scapture[];
+extern "C" uint32_t _ecapture[];
+
+namespace System
+{
+    enum class TriggerType : uint8_t
+    {
+        Level = 0,
+        Edge,
+        Slope
+    };
+
+    enum class TriggerDirection : uint8_t
+    {
+        Rising = 0,
+        Falling
+    };
+
+    enum class CaptureState : uint8_t
+    {
+        Idle = 0,
+        Armed,          // Recording, waiting for the pre-trigger part to fill and the trigger to fire
+        Triggered,      // Recording the post-trigger part
+        Complete        // Frozen until downloaded and re-armed
+    };
+
+    struct TriggerSettings
+    {
+        Channel Source{ Channel::Voltage };
+        TriggerType Type{ TriggerType::Level };
+        TriggerDirection Direction{ TriggerDirection::Rising };
+        int32_t Threshold{ 0 };     // Fine units, level and edge triggers
+        int32_t Slope{ 0 };         // Fine units per sample, slope trigger
+        uint32_t PostTrigger{ 0 };  // Samples kept after the trigger, the rest of the buffer is pre-trigger
+    };
+
+    // Leads every download, followed by Frames samples oldest first
+    struct CaptureHeader
+    {
+        uint32_t Magic{ 0 };
+        uint32_t Frames{ 0 };
+        uint32_t TriggerFrame{ 0 };
+        uint32_t FineBits{ 0 };
+        uint32_t Rate{ 0 };         // Samples per second, the acquisition mode the capture ran in sets it
+    };
+
+    class Capture
+    {
+    public:
+        static constexpr uint32_t Magic = 0x50414343u; // "CCAP"
+
+        using Block = Common::Containers::Span<int32_t const>;
+        using Bytes = Common::Containers::Span<uint8_t const>;
+
+        static std::size_t Depth() noexcept
+        {
+            return static_cast<std::size_t>(reinterpret_cast<uintptr_t>(_ecapture) - reinterpret_cast<uintptr_t>(_scapture)) / sizeof(Sample);
+        }
+        static CaptureState State() noexcept
+        {
+            return s_state;
+        }
+        // Starts a fresh capture, the interrupt ignores the buffer while the settings are swapped
+        static bool Arm(TriggerSettings const & settings) noexcept
+        {
+            std::size_t const depth{ Depth() };
+            if (settings.PostTrigger >= depth) { return false; }
+
+            s_state = CaptureState::Idle;
+            __DMB();
+
+            s_source = (settings.Source == Channel::Voltage) ? &Sample::Voltage : &Sample::Current;
+            s_sign = (settings.Direction == TriggerDirection::Rising) ? 1 : -1;
+            s_threshold = settings.Threshold;
+            s_slope = settings.Slope;
+            s_levelMask = (settings.Type == TriggerType::Level);
+            s_edgeMask = (settings.Type == TriggerType::Edge);
+            s_slopeMask = (settings.Type == TriggerType::Slope);
+            s_postTrigger = settings.PostTrigger;
+            s_remaining = settings.PostTrigger;
+            s_preTrigger = Common::Math::Maximum(depth - settings.PostTrigger, std::size_t{ 2u }); // Slope and edge need one previous sample
+            s_head = 0u;
+            s_filled = 0u;
+            s_wasAbove = true;
+            s_forced = false;
+            s_rate = 0u;
+
+            __DMB();
+            s_state = CaptureState::Armed;
+            return true;
+        }
+        static void Disarm() noexcept
+        {
+            s_state = CaptureState::Idle;
+        }
+        // Fires on the next sample once the pre-trigger part is full
+        static void Force() noexcept
+        {
+            s_forced = true;
+        }
+        // Called by the acquisition interrupt with each processed block, fine units at 'rate'. A rate change starts
+        // the capture over, one capture never mixes two acquisition modes.
+        static void Record(Block voltage, Block current, uint32_t const rate) noexcept
+        {
+            CaptureState state{ s_state };
+            if ((state != CaptureState::Armed) && (state != CaptureState::Triggered)) { return; }
+
+            Sample * const frames{ Frames() };
+            std::size_t const depth{ Depth() };
+
+            if (rate != s_rate)
+            {
+                state = CaptureState::Armed;
+                s_rate = rate;
+                s_remaining = s_postTrigger;
+                s_head = 0u;
+                s_filled = 0u;
+                s_wasAbove = true;
+            }
+
+            for (std::size_t i = 0; i < voltage.size(); ++i)
+            {
+                Sample const sample{ voltage[i], current[i] };
+
+                frames[s_head] = sample;
+                s_head = ((s_head + 1u) == depth) ? 0u : (s_head + 1u);
+                s_filled += (s_filled < depth) ? 1u : 0u;
+
+                if (state == CaptureState::Armed)
+                {
+                    if (Evaluate(sample.*s_source) && (s_filled >= s_preTrigger))
+                    {
+                        state = (s_remaining == 0u) ? CaptureState::Complete : CaptureState::Triggered;
+                    }
+                }
+                else if (--s_remaining == 0u)
+                {
+                    state = CaptureState::Complete;
+                }
+
+                if (state == CaptureState::Complete) { break; }
+            }
+
+            s_state = state;
+        }
+        // Hands a completed capture to 'write' as raw bytes, header first then the samples oldest first,
+        // straight out of the capture RAM in at most three calls
+        template <typename tWriter>
+        static bool Download(tWriter && write) noexcept
+        {
+            if (s_state != CaptureState::Complete) { return false; }
+
+            std::size_t const depth{ Depth() };
+            Sample const * const frames{ Frames() };
+
+            CaptureHeader const header
+            {
+                Magic,
+                static_cast<uint32_t>(depth),
+                static_cast<uint32_t>(depth - 1u - s_postTrigger),
+                Constants::SampleFineBits,
+                s_rate
+            };
+
+            write(Bytes{ reinterpret_cast<uint8_t const *>(&header), sizeof(header) });
+            write(Bytes{ reinterpret_cast<uint8_t const *>(frames + s_head), (depth - s_head) * sizeof(Sample) });
+            if (s_head != 0u)
+            {
+                write(Bytes{ reinterpret_cast<uint8_t const *>(frames), s_head * sizeof(Sample) });
+            }
+            return true;
+        }
+
+    private:
+        static Sample * Frames() noexcept
+        {
+            return reinterpret_cast<Sample *>(_scapture);
+        }
+        // All three trigger kinds are computed and masked, no branches per sample
+        ALWAYS_INLINE
+        static bool Evaluate(int32_t const value) noexcept
+        {
+            bool const above{ ((value - s_threshold) * s_sign) >= 0 };
+            bool const rising{ ((value - s_previous) * s_sign) >= s_slope };
+
+            uint32_t const fired
+            {
+                (uint32_t{ above } & s_levelMask)
+                | (uint32_t{ above && !s_wasAbove } & s_edgeMask)
+                | (uint32_t{ rising } & s_slopeMask)
+                | uint32_t{ s_forced }
+            };
+
+            s_previous = value;
+            s_wasAbove = above;
+            return (fired != 0u);
+        }
+
+    private:
+        inline static CaptureState volatile s_state{ CaptureState::Idle };
+        inline static bool volatile s_forced{ false };
+
+        inline static int32_t Sample::* s_source{ &Sample::Voltage };
+        inline static int32_t s_sign{ 1 };
+        inline static int32_t s_threshold{ 0 };
+        inline static int32_t s_slope{ 0 };
+        inline static uint32_t s_levelMask{ 0 };
+        inline static uint32_t s_edgeMask{ 0 };
+        inline static uint32_t s_slopeMask{ 0 };
+        inline static int32_t s_previous{ 0 };
+        inline static bool s_wasAbove{ true };
+
+        inline static std::size_t s_head{ 0 };
+        inline static std::size_t s_filled{ 0 };
+        inline static std::size_t s_preTrigger{ 0 };
+        inline static std::size_t s_postTrigger{ 0 };
+        inline static std::size_t s_remaining{ 0 };
+        inline static uint32_t s_rate{ 0 };
+    };
+}
\ No newline at end of file
@@ -0,0 +1,361 @@
+#pragma once
+
+#include "constants.hpp"
+#include "sample.hpp"
+#include "acquisition.hpp"
+#include "statistics.hpp"
+#include "capture.hpp"
+#include "stream.hpp"
+#include "regulator.hpp"
+#include "telemetry.hpp"
+#include "link.hpp"
+
+#include "common/atomic.hpp"
+#include "common/math.hpp"
+#include "common/command/parser.hpp"
+#include "common/command/dispatch.hpp"
+#include "common/command/response.hpp"
+#include "common/command/line_assembler.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace System
+{
+    // Text command layer: the receive interrupt assembles lines, the main loop parses them in place and replies.
+    // Values are plain integers or decimals, measurements are reported in ADC codes with three decimals. A line takes
+    // a few dozen ';' separated commands. A longer one is not run and is answered with ERR LINE, a reply that does not
+    // fit is cut short and ends in ERR OVER.
+    class Commands
+    {
+    public:
+        static constexpr std::size_t LineSize = 512u;
+        static constexpr std::size_t ResponseSize = 512u;
+        static constexpr unsigned Decimals = 3u;
+
+        using Frame = Common::Containers::Span<char const>;
+        using Arguments = Common::Command::Arguments;
+        using Response = Common::Command::Response<ResponseSize>;
+
+        // Receive interrupt, false holds the sender until Process() has freed a slot
+        static bool Feed(Frame frame) noexcept
+        {
+            s_lines.Feed(frame);
+            return s_lines.Ready();
+        }
+        // Main loop, handles at most one line per call
+        template <typename tSerial>
+        static void Process(tSerial & serial) noexcept
+        {
+            auto const line{ s_lines.Take() };
+            if (!line.has_value()) { return; }
+
+            s_response.Clear();
+            if (s_lines.Truncated()) { Error(s_response, "LINE"); }
+            else if (Common::Command::Execute(s_table, line.value(), s_response) == 0u) { Link::Confirm(); }
+            s_lines.Release();
+            Resume(serial);
+
+            Send(serial, s_response.View());
+            if (s_response.Overflow()) { Send(serial, Text(";ERR OVER")); }
+            Send(serial, Text("\r\n"));
+
+            if (s_dumpRequested)
+            {
+                s_dumpRequested = false;
+                MessageType type{ MessageType::CaptureHeader };
+                Capture::Download([&serial, &type](Capture::Bytes bytes)
+                {
+                    Telemetry::Send(serial, type, bytes);
+                    type = MessageType::CaptureData;
+                });
+            }
+        }
+
+    private:
+        // Checked with the receive interrupt masked so a hold it takes in between is not undone
+        template <typename tSerial>
+        static void Resume(tSerial & serial) noexcept
+        {
+            Common::CriticalSection const lock{};
+            if (serial.Held() && s_lines.Ready()) { serial.Resume(); }
+        }
+        // Buffers go out by DMA without a copy, so each one is held until it has left
+        template <typename tSerial>
+        static void Send(tSerial & serial, Frame data) noexcept
+        {
+            while (!serial.Write(data)) {}
+            while (!serial.Idle()) {}
+        }
+
+        // Literals sit in flash for as long as the DMA needs them
+        static Frame Text(std::string_view const text) noexcept
+        {
+            return Frame{ text.data(), text.size() };
+        }
+
+        static std::optional<Channel> ParseChannel(Arguments & args) noexcept
+        {
+            auto const token{ args.Next() };
+            if (Common::Command::Equal(token, "V")) { return Channel::Voltage; }
+            if (Common::Command::Equal(token, "I")) { return Channel::Current; }
+            return {};
+        }
+        static void Fine(Response & response, int32_t const value) noexcept
+        {
+            constexpr int64_t scale{ 1000 };
+            response.Decimal((int64_t{ value } * scale) >> Acquisition::FineBits, Decimals);
+        }
+        static Regulator::Controller::ValueType ToGain(int32_t const milli) noexcept
+        {
+            return static_cast<Regulator::Controller::ValueType>((int64_t{ milli } * Regulator::Controller::One) / 1000);
+        }
+        static void Error(Response & response, char const * const what) noexcept
+        {
+            response.Separator().Text("ERR ").Text(what);
+        }
+        static void Ok(Response & response) noexcept
+        {
+            response.Separator().Text("OK");
+        }
+
+        static void Identify(Arguments &, Response & response) noexcept
+        {
+            response.Separator().Text("PPCM,0.1");
+        }
+        static void SetVoltage(Arguments & args, Response & response) noexcept
+        {
+            if (auto const counts{ args.Integer() }) { Regulator::SetVoltage(counts.value()); Ok(response); }
+            else { Error(response, "VOLT"); }
+        }
+        static void SetCurrent(Arguments & args, Response & response) noexcept
+        {
+            if (auto const counts{ args.Integer() }) { Regulator::SetCurrent(counts.value()); Ok(response); }
+            else { Error(response, "CURR"); }
+        }
+        static void Output(Arguments & args, Response & response) noexcept
+        {
+            auto const state{ args.Integer() };
+            if (!state.has_value()) { Error(response, "OUTP"); return; }
+
+            if (state.value() == 0) { Regulator::Stop(); }
+            else if (!Regulator::Start()) { Error(response, "OUTP"); return; }
+            Ok(response);
+        }
+        // SOUR:GAIN <V|I> <kp> <ki> <kd>, decimals per count of error. Refused while the output is on.
+        static void SetGains(Arguments & args, Response & response) noexcept
+        {
+            auto const channel{ ParseChannel(args) };
+            auto const kp{ args.Decimal(Decimals) };
+            auto const ki{ args.Decimal(Decimals) };
+            auto const kd{ args.Decimal(Decimals) };
+
+            if (!channel.has_value() || !kp.has_value() || !ki.has_value() || !kd.has_value()) { Error(response, "GAIN"); return; }
+
+            Regulator::Gains const gains{ ToGain(kp.value()), ToGain(ki.value()), ToGain(kd.value()) };
+            if (Regulator::SetGains(channel.value(), gains)) { Ok(response); }
+            else { Error(response, "GAIN"); }
+        }
+        static void SetMode(Arguments & args, Response & response) noexcept
+        {
+            auto const token{ args.Next() };
+            if (Common::Command::Equal(token, "FILT")) { Acquisition::SetMode(AcquisitionMode::Filtered); }
+            else if (Common::Command::Equal(token, "OVER")) { Acquisition::SetMode(AcquisitionMode::Oversampled); }
+            else if (Common::Command::Equal(token, "COMP")) { Acquisition::SetMode(AcquisitionMode::OversampledCompensated); }
+            else { Error(response, "MODE"); return; }
+            Ok(response);
+        }
+        // Active path and the rate its samples come out at, a new mode shows here once its first block has run
+        static void ReadMode(Arguments &, Response & response) noexcept
+        {
+            constexpr char const * names[]{ "FILT,", "OVER,", "COMP," };
+            response.Separator().Text(names[Common::Tools::EnumValue(Acquisition::Mode())]).Integer(Acquisition::OutputRate());
+        }
+        static void Measure(Arguments &, Response & response) noexcept
+        {
+            Sample const sample{ Acquisition::LatestFine() };
+            response.Separator();
+            Fine(response, sample.Voltage);
+            response.Char(',');
+            Fine(response, sample.Current);
+        }
+        static void MeasureVoltage(Arguments &, Response & response) noexcept
+        {
+            response.Separator();
+            Fine(response, Acquisition::LatestFine().Voltage);
+        }
+        static void MeasureCurrent(Arguments &, Response & response) noexcept
+        {
+            response.Separator();
+            Fine(response, Acquisition::LatestFine().Current);
+        }
+        // CALC:STAT? <V|I>, minimum, maximum, mean, RMS and standard deviation in codes, then the sample count. Minimum,
+        // maximum and RMS cover the last Statistics::Window samples, the rest run since the last reset.
+        static void ReadStatistics(Arguments & args, Response & response) noexcept
+        {
+            auto const channel{ ParseChannel(args) };
+            if (!channel.has_value()) { Error(response, "STAT?"); return; }
+
+            Summary const summary{ Statistics::Read(Common::Tools::EnumValue(channel.value())) };
+            response.Separator();
+            Fine(response, summary.Minimum);
+            response.Char(',');
+            Fine(response, summary.Maximum);
+            response.Char(',');
+            Fine(response, summary.Mean);
+            response.Char(',');
+            Fine(response, static_cast<int32_t>(summary.RMS));
+            response.Char(',');
+            Fine(response, static_cast<int32_t>(Common::Math::IntegerSqrt(static_cast<uint64_t>(summary.Variance))));
+            response.Char(',').Integer(summary.Count);
+        }
+        static void ResetStatistics(Arguments &, Response & response) noexcept
+        {
+            Statistics::Reset();
+            Ok(response);
+        }
+        // TRIG:ARM <V|I> <LEV|EDGE|SLOP> <RISE|FALL> <threshold> <post>, threshold in codes (codes per sample for slope)
+        static void Arm(Arguments & args, Response & response) noexcept
+        {
+            TriggerSettings settings{};
+
+            auto const channel{ ParseChannel(args) };
+            auto const type{ args.Next() };
+            auto const direction{ args.Next() };
+            auto const threshold{ args.Decimal(Decimals) };
+            auto const post{ args.Integer() };
+
+            if (!channel.has_value() || !threshold.has_value() || !post.has_value() || (post.value() < 0)) { Error(response, "ARM"); return; }
+
+            settings.Source = channel.value();
+            if (Common::Command::Equal(type, "LEV")) { settings.Type = TriggerType::Level; }
+            else if (Common::Command::Equal(type, "EDGE")) { settings.Type = TriggerType::Edge; }
+            else if (Common::Command::Equal(type, "SLOP")) { settings.Type = TriggerType::Slope; }
+            else { Error(response, "ARM"); return; }
+
+            settings.Direction = Common::Command::Equal(direction, "FALL") ? TriggerDirection::Falling : TriggerDirection::Rising;
+
+            int32_t const fine{ static_cast<int32_t>((int64_t{ threshold.value() } << Acquisition::FineBits) / 1000) };
+            settings.Threshold = fine;
+            settings.Slope = fine;
+            settings.PostTrigger = static_cast<uint32_t>(post.value());
+
+            if (Capture::Arm(settings)) { Ok(response); }
+            else { Error(response, "ARM"); }
+        }
+        static void Trigger(Arguments &, Response & response) noexcept
+        {
+            Capture::Force();
+            Ok(response);
+        }
+        static void CaptureStatus(Arguments &, Response & response) noexcept
+        {
+            response.Separator().Integer(Common::Tools::EnumValue(Capture::State())).Char(',').Integer(static_cast<int64_t>(Capture::Depth()));
+        }
+        // The capture follows the text reply as telemetry frames, header first
+        static void Dump(Arguments &, Response & response) noexcept
+        {
+            if (Capture::State() != CaptureState::Complete) { Error(response, "DUMP"); return; }
+            s_dumpRequested = true;
+            Ok(response);
+        }
+        // STR <decimation>, 0 stops. The decimation is the finest the stream may use, it backs off when the link is full.
+        static void SetStream(Arguments & args, Response & response) noexcept
+        {
+            auto const decimation{ args.Integer() };
+            if (!decimation.has_value() || (decimation.value() < 0) || (decimation.value() > Stream::MaxDecimation)) { Error(response, "STR"); return; }
+
+            if (decimation.value() == 0) { Stream::Stop(); }
+            else { Stream::Start(static_cast<uint16_t>(decimation.value())); }
+            Ok(response);
+        }
+        static void StreamStatus(Arguments &, Response & response) noexcept
+        {
+            auto const status{ Stream::Status() };
+            response.Separator().Integer(status.Active ? 1 : 0).Char(',').Integer(status.Decimation).Char(',').Integer(status.Frames).Char(',').Integer(status.Dropped);
+        }
+        // SYST:COMM:SER:BAUD <rate>, the OK still goes out at the current rate
+        static void SetBaud(Arguments & args, Response & response) noexcept
+        {
+            auto const rate{ args.Integer() };
+            if (!rate.has_value() || (rate.value() <= 0) || !Link::Reachable(static_cast<uint32_t>(rate.value()))) { Error(response, "BAUD"); return; }
+
+            Link::Request(static_cast<uint32_t>(rate.value()));
+            Ok(response);
+        }
+        static void ReadBaud(Arguments &, Response & response) noexcept
+        {
+            response.Separator().Integer(Link::Current()).Char(',').Integer(Link::Fastest());
+        }
+        static void AutoBaud(Arguments &, Response & response) noexcept
+        {
+            Link::RequestAutoBaud();
+            Ok(response);
+        }
+        static void Errors(Arguments &, Response & response) noexcept
+        {
+            response.Separator().Integer(s_lines.Dropped());
+        }
+        // Telemetry frame buffers: in use, high-water mark, refused claims
+        static void Memory(Arguments &, Response & response) noexcept
+        {
+            auto const buffers{ Telemetry::Buffers() };
+            response.Separator().Integer(buffers.InUse).Char(',').Integer(buffers.HighWater).Char(',').Integer(buffers.Failures);
+        }
+
+        // Core cycles: last acquisition block, its worst case and its samples, then the regulator tick's cycles, worst
+        // case, latency in timer ticks, worst latency and worst jitter
+        static void Timing(Arguments &, Response & response) noexcept
+        {
+            ProcessingTime const block{ Acquisition::Time() };
+            LoopTiming const loop{ Regulator::Timing() };
+
+            response.Separator().Integer(block.Cycles).Char(',').Integer(block.MaxCycles).Char(',').Integer(block.Samples);
+            response.Char(',').Integer(loop.Cycles).Char(',').Integer(loop.MaxCycles).Char(',').Integer(loop.Latency).Char(',').Integer(loop.MaxLatency).Char(',').Integer(loop.MaxJitter);
+        }
+
+        using Command = Common::Command::Command<Response>;
+
+        static constexpr std::array s_commands
+        {
+            Command{ "*IDN?", &Identify },
+            Command{ "SOURce:VOLTage", &SetVoltage },
+            Command{ "SOURce:CURRent", &SetCurrent },
+            Command{ "SOURce:GAIN", &SetGains },
+            Command{ "OUTPut", &Output },
+            Command{ "SENSe:MODE", &SetMode },
+            Command{ "SENSe:MODE?", &ReadMode },
+            Command{ "MEASure?", &Measure },
+            Command{ "MEASure:VOLTage?", &MeasureVoltage },
+            Command{ "MEASure:CURRent?", &MeasureCurrent },
+            Command{ "CALCulate:STATistics?", &ReadStatistics },
+            Command{ "CALCulate:STATistics:RESet", &ResetStatistics },
+            Command{ "TRIGger", &Trigger },
+            Command{ "TRIGger:ARM", &Arm },
+            Command{ "TRIGger:STATe?", &CaptureStatus },
+            Command{ "TRACe:DATA?", &Dump },
+            Command{ "STReam", &SetStream },
+            Command{ "STReam?", &StreamStatus },
+            Command{ "SYSTem:ERRor?", &Errors },
+            Command{ "SYSTem:MEMory?", &Memory },
+            Command{ "SYSTem:TIMing?", &Timing },
+            Command{ "SYSTem:COMMunicate:SERial:BAUD", &SetBaud },
+            Command{ "SYSTem:COMMunicate:SERial:BAUD?", &ReadBaud },
+            Command{ "SYSTem:COMMunicate:SERial:AUTO", &AutoBaud }
+        };
+
+        using Table = Common::Command::HashTable<Response, Common::Command::KeyCount(s_commands)>;
+
+        static constexpr Table s_table{ Table::Build(s_commands) };
+
+        static_assert(s_table.Valid(), "Command aliases must be unique and fit the table.");
+
+        inline static Common::Command::LineAssembler<LineSize> s_lines{};
+        inline static Response s_response{};
+        inline static bool s_dumpRequested{ false };
+    };
+}
\ No newline at end of file
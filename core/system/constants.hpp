@@ -17,6 +17,23 @@ namespace System
         constexpr uint32_t const HSE_Clock = 8_MHz;
 
         constexpr float const VDD_Voltage = 3.3_v;
+
+        constexpr uint32_t const RegulatorRate = 10_KHz;
+        constexpr unsigned const ControlPriority = 0u;
+
+        constexpr uint32_t const SampleRate = 10_KHz;
+        constexpr unsigned const AcquisitionPriority = 1u;  // Below the control tick, above the serial link
+        constexpr uint32_t const MainsFrequency = 50_Hz;
+        constexpr uint32_t const AcquisitionCorner = 1_KHz;
+        constexpr std::size_t const AcquisitionBlockSize = 32u;
+        constexpr unsigned const DecimatorOrder = 3u;
+        constexpr std::size_t const OversampleRatio = 16u;
+        constexpr std::size_t const StatisticsWindow = 64u;
+        constexpr unsigned const SampleFineBits = 8u;
+        constexpr std::size_t const TelemetryPayload = 256u;
+        constexpr std::size_t const TelemetryBuffers = 4u;
+        constexpr std::size_t const LogWords = 256u;
+        constexpr uint32_t const ConsoleWait = 2_ms; // Longest a printf waits for a free line
     }
 
     namespace Pins
@@ -28,8 +45,14 @@ namespace System
         using DAC_SYNC = IO::Module<IO::Port::B, 10>;
         using STATUS_LED = IO::Module<IO::Port::C, 13>;
 
+        // ADC1 inputs 0 and 1
+        using VOLTAGE_SENSE = IO::Module<IO::Port::A, 0>;
+        using CURRENT_SENSE = IO::Module<IO::Port::A, 1>;
+
         using USART_TX = IO::Module<IO::Port::A, 9>;
         using USART_RX = IO::Module<IO::Port::A, 10>;
+        using USART_CTS = IO::Module<IO::Port::A, 11>;
+        using USART_RTS = IO::Module<IO::Port::A, 12>;
 
         using SPI1_SCLK = IO::Module<IO::Port::A, 5>;
         using SPI1_MOSI = IO::Module<IO::Port::A, 7>;
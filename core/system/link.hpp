@@ -0,0 +1,121 @@
+#pragma once
+
+#include "types.hpp"
+#include "log.hpp"
+
+#include "mcu/usart.hpp"
+
+#include <cstdint>
+
+namespace System
+{
+    // Serial rate negotiation. A rate change is acknowledged at the old rate and applied once that reply has left, then
+    // the host has ConfirmTime to get one clean command through at the new rate or the link falls back. Auto-baud
+    // listens for a 0x55 sync byte, the host follows it with a line break to flush what the USART made of it.
+    class Link
+    {
+    public:
+        static constexpr uint64_t ConfirmTime = 2000u;    // Ticks, ms
+        static constexpr uint64_t AutoBaudTime = 5000u;
+
+        static constexpr uint32_t ClockFrequency = SerialProperties::s_PeriphClockFreq;
+        static constexpr uint32_t Tolerance = SerialProperties::s_BaudTolerancePpm;
+
+        [[nodiscard]]
+        static constexpr bool Reachable(uint32_t const baud_rate) noexcept
+        {
+            return MCU::USART::BaudReachable(ClockFrequency, baud_rate, Tolerance);
+        }
+        static constexpr uint32_t Fastest() noexcept
+        {
+            return MCU::USART::FastestBaud(ClockFrequency, Tolerance);
+        }
+        static uint32_t Current() noexcept
+        {
+            return s_current;
+        }
+
+        // Command handlers, applied by the next Poll() after the reply is out
+        static void Request(uint32_t const baud_rate) noexcept
+        {
+            s_requested = baud_rate;
+        }
+        static void RequestAutoBaud() noexcept
+        {
+            s_autoRequested = true;
+        }
+        // A line ran without errors, so the host talks at the current rate
+        static void Confirm() noexcept
+        {
+            s_fallback = 0u;
+        }
+
+        // Main loop
+        template <typename tSerial>
+        static void Poll(tSerial & serial, uint64_t const now) noexcept
+        {
+            if (s_requested != 0u)
+            {
+                Switch(serial, s_requested, now);
+                s_requested = 0u;
+            }
+            if (s_autoRequested)
+            {
+                s_autoRequested = false;
+                Detector().Arm();
+                s_autoDeadline = now + AutoBaudTime;
+            }
+
+            if (s_autoDeadline != 0u)
+            {
+                uint32_t const measured{ Detector().Result() };
+                if (measured != 0u)
+                {
+                    s_autoDeadline = 0u;
+                    uint32_t const rate{ MCU::USART::NearestStandardBaud(measured, Tolerance) };
+                    if (Reachable(rate)) { Switch(serial, rate, now); }
+                }
+                else if (now >= s_autoDeadline)
+                {
+                    s_autoDeadline = 0u;
+                    Detector().Disarm();
+                }
+            }
+
+            if ((s_fallback != 0u) && (now >= s_confirmDeadline))
+            {
+                serial.SetBaudRate(s_fallback);
+                s_current = serial.BaudRate();
+                s_fallback = 0u;
+                LOG("link: unconfirmed, back to %u baud", s_current);
+            }
+        }
+
+    private:
+        template <typename tSerial>
+        static void Switch(tSerial & serial, uint32_t const baud_rate, uint64_t const now) noexcept
+        {
+            uint32_t const previous{ serial.BaudRate() };
+            if (serial.SetBaudRate(baud_rate))
+            {
+                s_fallback = (s_fallback != 0u) ? s_fallback : previous; // Keep the last rate that was confirmed
+                s_confirmDeadline = now + ConfirmTime;
+                s_current = serial.BaudRate();
+                LOG("link: %u -> %u baud", previous, s_current);
+            }
+        }
+        static SerialAutoBaud & Detector() noexcept
+        {
+            static SerialAutoBaud detector{};
+            return detector;
+        }
+
+    private:
+        inline static uint32_t s_current{ SerialProperties::s_AchievedBaud };
+        inline static uint32_t s_requested{ 0 };
+        inline static bool s_autoRequested{ false };
+        inline static uint32_t s_fallback{ 0 };
+        inline static uint64_t s_confirmDeadline{ 0 };
+        inline static uint64_t s_autoDeadline{ 0 };
+    };
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "macros.h"
+#include "constants.hpp"
+#include "types.hpp"
+#include "telemetry.hpp"
+
+#include "mcu/cycle_counter.hpp"
+
+#include "common/log/deferred.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Deferred log line, any context. Costs a reservation and a few stores, formatting happens on the host:
+// LOG("baud %u -> %u", old_rate, new_rate). Arguments are numbers, enums or pointers, see Common::Log::Deferred.
+#define LOG(format, ...) ::System::Log::Write(DEFERRED_LOG_FORMAT(format) __VA_OPT__(,) __VA_ARGS__)
+
+namespace System
+{
+    // Leads the records of every log frame
+    struct LogHeader
+    {
+        uint32_t Dropped{ 0 };      // Records lost to a full ring since reset
+        uint32_t Clock{ 0 };        // Core clock the timestamps count
+    };
+
+    // Records carry the core cycle count as timestamp and leave as telemetry frames whenever the link has room
+    class Log
+    {
+    public:
+        using Ring = Common::Log::Deferred<Constants::LogWords>;
+
+        static constexpr std::size_t FrameWords = (Telemetry::MaxPayload - sizeof(LogHeader)) / sizeof(uint32_t);
+
+        template <typename... tArgs>
+        ALWAYS_INLINE
+        static bool Write(uint32_t const format, tArgs const ... args) noexcept
+        {
+            return s_ring.Write(format, MCU::TRACE::CycleCounter::Now(), args...);
+        }
+        static uint32_t Dropped() noexcept
+        {
+            return s_ring.Dropped();
+        }
+
+        // Idle task, never waits on the link
+        template <typename tSerial>
+        static void Poll(tSerial & serial) noexcept
+        {
+            if (s_pending.empty())
+            {
+                if (s_ring.Empty()) { return; }
+
+                s_buffer = Telemetry::Claim(serial);
+                if (!s_buffer) { return; } // Every frame buffer is queued or on the wire
+
+                std::size_t const words{ s_ring.Read(s_words) };
+                if (words == 0u)
+                {
+                    s_buffer.Release(); // The oldest record is still being written
+                    return;
+                }
+
+                s_pending = Telemetry::Encode
+                (
+                    *s_buffer,
+                    MessageType::Log,
+                    LogHeader{ s_ring.Dropped(), SystemBus_t::SystemClockFreq() },
+                    Telemetry::Bytes{ reinterpret_cast<uint8_t const *>(s_words.data()), words * sizeof(uint32_t) }
+                );
+            }
+
+            if (!Telemetry::Submit(serial, s_buffer, s_pending)) { return; }
+
+            s_pending = Telemetry::Frame{};
+        }
+
+    private:
+        inline static Ring s_ring{};
+        inline static std::array<uint32_t, FrameWords> s_words{};
+        inline static Telemetry::Buffer s_buffer{};
+        inline static Telemetry::Frame s_pending{};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "types.hpp"
+#include "constants.hpp"
+#include "acquisition.hpp"
+
+#include "mcu/tim.hpp"
+#include "mcu/spi.hpp"
+#include "mcu/cycle_counter.hpp"
+#include "external/dac80004.hpp"
+#include "common/atomic.hpp"
+#include "common/control/pid.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace System
+{
+    enum class RegulationMode : uint8_t
+    {
+        Off = 0,
+        ConstantVoltage,
+        ConstantCurrent
+    };
+
+    struct LoopTiming
+    {
+        uint32_t Cycles{ 0 };       // Core cycles spent in the last tick
+        uint32_t MaxCycles{ 0 };
+        uint32_t Latency{ 0 };      // Timer ticks from the update event to the DAC frame being started
+        uint32_t MaxLatency{ 0 };
+        uint32_t MaxJitter{ 0 };    // Worst deviation of the tick spacing from the nominal period, in core cycles
+        uint32_t Ticks{ 0 };
+    };
+
+    class Regulator
+    {
+    private:
+        static constexpr auto OutputChannel = External::DAC80004::Channel::A;
+
+        using DAC_t = External::DAC80004::Module<DAC_Properties, BoardPins::Pin<Pins::DAC_SYNC>>;
+        using TimerHW = MCU::TIM::HardwareKernal<Common::Tools::EnumValue(RegulatorTimer::s_Peripheral)>;
+
+        // The tick starts a frame and the SPI1 interrupt finishes it at the same priority, so one still in flight at the
+        // next tick would be waited for with its own interrupt held off
+        static constexpr uint32_t FrameCycles{ 32u * (2u << Common::Tools::EnumValue(DAC_Properties::s_ClockDiv)) * (SystemBus_t::SystemClockFreq() / SystemBus_t::APB2_ClockFreq()) };
+        static_assert(FrameCycles < (SystemBus_t::SystemClockFreq() / Constants::RegulatorRate));
+
+        static auto & Bus() noexcept
+        {
+            static auto bus{ MCU::SPI::Module{ DAC_Properties{}, Common::Bound<&DAC_t::Complete>{} } };
+            return bus;
+        }
+        static auto & Timer() noexcept
+        {
+            static auto timer{ MCU::TIM::Module{ RegulatorTimer{}, Common::Bound<&Tick>{} } };
+            return timer;
+        }
+
+    public:
+        using Controller = Common::Control::PID<16u>;
+        using Gains = Controller::Gains;
+
+        static constexpr int32_t OutputMin = 0;
+        static constexpr int32_t OutputMax = std::numeric_limits<uint16_t>::max();
+
+        Regulator() noexcept
+        {
+            MCU::TRACE::CycleCounter::Enable();
+
+            (void)Bus();
+            (void)Timer();
+
+            DAC_t::SetOutput<OutputChannel>(OutputMin);
+        }
+        ~Regulator() noexcept
+        {
+            Stop();
+        }
+
+        // Refuses until both loops have gains, with none the output would just sit at OutputMin
+        static bool Start() noexcept
+        {
+            if (!Configured()) { return false; }
+
+            Sample const sample{ Acquisition::Newest() };
+
+            s_voltageLoop.Reset(OutputMin, sample.Voltage);
+            s_currentLoop.Reset(OutputMin, sample.Current);
+            s_timing = LoopTiming{};
+            s_lastEntry = MCU::TRACE::CycleCounter::Now();
+            s_mode = RegulationMode::ConstantVoltage;
+
+            Timer().Start();
+            return true;
+        }
+        static void Stop() noexcept
+        {
+            Timer().Stop();
+
+            s_mode = RegulationMode::Off;
+            DAC_t::SetOutput<OutputChannel>(OutputMin);
+        }
+        static void SetVoltage(int32_t const counts) noexcept
+        {
+            s_voltageSetpoint = counts;
+        }
+        static void SetCurrent(int32_t const counts) noexcept
+        {
+            s_currentSetpoint = counts;
+        }
+        // Gains span several words, they are refused while the loop runs. A loop without Kp and Ki counts as unset.
+        static bool SetGains(Channel const channel, Gains const gains) noexcept
+        {
+            if (s_mode != RegulationMode::Off) { return false; }
+
+            if (channel == Channel::Voltage) { s_voltageLoop.SetGains(gains); }
+            else { s_currentLoop.SetGains(gains); }
+            s_configured[Common::Tools::EnumValue(channel)] = ((gains.Kp != 0) || (gains.Ki != 0));
+            return true;
+        }
+        static bool Configured() noexcept
+        {
+            return (s_configured[0] && s_configured[1]);
+        }
+        static RegulationMode Mode() noexcept
+        {
+            return s_mode;
+        }
+        // The tick rewrites several words, the copy is taken with it held off
+        static LoopTiming Timing() noexcept
+        {
+            Common::CriticalSection const lock{};
+            return s_timing;
+        }
+        static constexpr uint32_t PeriodCycles() noexcept
+        {
+            return (SystemBus_t::SystemClockFreq() / Constants::RegulatorRate);
+        }
+
+        static void Tick() noexcept
+        {
+            uint32_t const entry{ MCU::TRACE::CycleCounter::Now() };
+            Sample const sample{ Acquisition::Newest() };
+
+            int32_t const cv{ s_voltageLoop.Update(s_voltageSetpoint, sample.Voltage) };
+            int32_t const cc{ s_currentLoop.Update(s_currentSetpoint, sample.Current) };
+
+            // Min-select: whichever loop asks for less drive owns the output, the other one tracks it for a bumpless hand-over
+            bool const currentLimited{ cc < cv };
+            int32_t const output{ currentLimited ? cc : cv };
+
+            if (currentLimited) { s_voltageLoop.Track(output); }
+            else { s_currentLoop.Track(output); }
+
+            DAC_t::SetOutput<OutputChannel>(static_cast<uint16_t>(output));
+
+            s_mode = currentLimited ? RegulationMode::ConstantCurrent : RegulationMode::ConstantVoltage;
+
+            Measure(entry);
+        }
+
+    private:
+        ALWAYS_INLINE
+        static void Measure(uint32_t const entry) noexcept
+        {
+            uint32_t const latency{ TimerHW::Counter() };
+            uint32_t const cycles{ MCU::TRACE::CycleCounter::Since(entry) };
+            uint32_t const spacing{ entry - s_lastEntry };
+            uint32_t const jitter{ (spacing > PeriodCycles()) ? (spacing - PeriodCycles()) : (PeriodCycles() - spacing) };
+
+            s_lastEntry = entry;
+
+            s_timing.Cycles = cycles;
+            s_timing.MaxCycles = Common::Math::Maximum(s_timing.MaxCycles, cycles);
+            s_timing.Latency = latency;
+            s_timing.MaxLatency = Common::Math::Maximum(s_timing.MaxLatency, latency);
+            // The first spacing after Start() is arbitrary
+            if (s_timing.Ticks++ != 0u) { s_timing.MaxJitter = Common::Math::Maximum(s_timing.MaxJitter, jitter); }
+        }
+
+    private:
+        DAC_t const m_dac{ Constants::VDD_Voltage };
+
+        inline static Controller s_voltageLoop{ Gains{}, OutputMin, OutputMax };
+        inline static Controller s_currentLoop{ Gains{}, OutputMin, OutputMax };
+        inline static std::array<bool, 2u> s_configured{};
+        inline static int32_t volatile s_voltageSetpoint{ 0 };
+        inline static int32_t volatile s_currentSetpoint{ 0 };
+        inline static RegulationMode volatile s_mode{ RegulationMode::Off };
+        inline static uint32_t s_lastEntry{ 0 };
+        inline static LoopTiming s_timing{};
+    };
+}
\ No newline at end of file
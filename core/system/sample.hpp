@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace System
+{
+    enum class Channel : uint8_t
+    {
+        Voltage = 0,
+        Current
+    };
+
+    struct Sample
+    {
+        int32_t Voltage{ 0 };
+        int32_t Current{ 0 };
+    };
+}
\ No newline at end of file
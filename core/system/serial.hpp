@@ -6,23 +6,10 @@
 
 namespace System
 {
-    template <typename SysCore, typename GoodFunc, typename BadFunc>
-    auto Serial(GoodFunc && good, BadFunc && bad) noexcept
+    // 'tOnFrame' is bound at compile time, the receive interrupt calls it directly
+    template <auto tOnFrame>
+    auto Serial() noexcept
     {
-        return MCU::USART::Module
-        {
-            SerialProperties{},
-            [ g{ std::forward<GoodFunc>(good) }, b{ std::forward<BadFunc>(bad) } ](bool const q)
-            {
-                if (q)
-                {
-                    g();
-                }
-                else {
-                    b();
-                }
-            }
-        };
+        return MCU::USART::Module{ SerialProperties{}, Common::Bound<tOnFrame>{} };
     }
-}
-
+}
\ No newline at end of file
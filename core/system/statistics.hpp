@@ -0,0 +1,111 @@
+#pragma once
+
+#include "macros.h"
+#include "constants.hpp"
+
+#include "common/dsp/statistics.hpp"
+#include "common/containers/span.hpp"
+
+#include "stm32f1xx.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace System
+{
+    // All values in the acquisition's fine units, ADC codes with Acquisition::FineBits fractional bits
+    struct Summary
+    {
+        int32_t Minimum{ 0 };       // Over the last Statistics::Window samples
+        int32_t Maximum{ 0 };
+        uint32_t RMS{ 0 };
+        int32_t Mean{ 0 };          // Running since the last reset
+        int64_t Variance{ 0 };
+        uint32_t Count{ 0 };
+    };
+
+    // Fed with every processed block by the acquisition interrupt and read from thread context. A snapshot is taken
+    // at the end of each block, readers retry when a block completes while they copy it.
+    class Statistics
+    {
+    public:
+        static constexpr std::size_t ChannelCount = 2u;
+        static constexpr std::size_t Window = Constants::StatisticsWindow;
+
+        using Block = Common::Containers::Span<int32_t const>;
+
+        static void Update(std::size_t const channel, Block block) noexcept
+        {
+            if (s_resetRequested) { ResetState(); }
+
+            Tracker & tracker{ s_trackers[channel] };
+            for (std::size_t i = 0; i < block.size(); ++i)
+            {
+                int32_t const value{ block[i] };
+                tracker.Extrema.Push(value);
+                tracker.Moments.Push(value);
+                tracker.Power.Push(value);
+            }
+
+            s_sequence = s_sequence + 1u;
+            __DMB();
+            s_summaries[channel] = Summary
+            {
+                tracker.Extrema.Minimum(),
+                tracker.Extrema.Maximum(),
+                tracker.Power.RMS(),
+                tracker.Moments.Mean(),
+                tracker.Moments.Variance(),
+                tracker.Moments.Count()
+            };
+            __DMB();
+            s_sequence = s_sequence + 1u;
+        }
+        [[nodiscard]]
+        static Summary Read(std::size_t const channel) noexcept
+        {
+            Summary summary{};
+            uint32_t sequence{ 0 };
+            do
+            {
+                sequence = s_sequence;
+                __DMB();
+                summary = s_summaries[channel];
+                __DMB();
+            } while (sequence != s_sequence);
+
+            return summary;
+        }
+        // Applied by the next update, the interrupt owns the trackers
+        static void Reset() noexcept
+        {
+            s_resetRequested = true;
+        }
+
+    private:
+        struct Tracker
+        {
+            Common::DSP::SlidingExtrema<Window> Extrema;
+            Common::DSP::Welford<> Moments;
+            Common::DSP::SlidingRMS<Window> Power;
+        };
+
+        static void ResetState() noexcept
+        {
+            s_resetRequested = false;
+            for (auto & tracker : s_trackers)
+            {
+                tracker.Extrema.Reset();
+                tracker.Moments.Reset();
+                tracker.Power.Reset();
+            }
+        }
+
+    private:
+        inline static std::array<Tracker, ChannelCount> s_trackers{};
+        inline static std::array<Summary, ChannelCount> s_summaries{};
+        inline static uint32_t volatile s_sequence{ 0 };
+        inline static bool volatile s_resetRequested{ false };
+    };
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+#pragma once
+
+#include "macros.h"
+#include "constants.hpp"
+#include "sample.hpp"
+#include "telemetry.hpp"
+#include "log.hpp"
+
+#include "common/math.hpp"
+#include "common/containers/span.hpp"
+
+#include "stm32f1xx.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace System
+{
+    // Leads the samples of every stream frame
+    struct StreamHeader
+    {
+        uint32_t Index{ 0 };        // Acquisition output sample the first value starts at, counted from Start()
+        uint32_t Dropped{ 0 };      // Frames lost to a full queue since Start()
+        uint16_t Decimation{ 1 };   // Acquisition samples averaged into each value of this frame
+        uint8_t Mode{ 0 };          // AcquisitionMode the samples were produced in
+        uint8_t FineBits{ 0 };
+    };
+
+    struct StreamStatus
+    {
+        bool Active{ false };
+        uint16_t Decimation{ 1 };
+        uint32_t Frames{ 0 };
+        uint32_t Dropped{ 0 };
+    };
+
+    // Continuous voltage/current telemetry. The acquisition interrupt averages samples down by the current decimation
+    // into a queue of frame sized slots and never waits: with no free slot the frame is counted as dropped. The idle
+    // task encodes ready slots into DMA buffers and queues them without blocking, the DMA completion interrupt chains
+    // them onto the wire. A backed up queue doubles the decimation, an empty one halves it back towards the minimum.
+    class Stream
+    {
+    public:
+        static constexpr std::size_t SamplesPerFrame = (Constants::TelemetryPayload - sizeof(StreamHeader)) / sizeof(Sample);
+        static constexpr std::size_t Slots = 4u;
+        static constexpr uint16_t MaxDecimation = 1024u;
+
+        static_assert(Common::Math::IsPowerOfTwo(Slots), "Slot count must be a power of two.");
+        static_assert(Common::Math::IsPowerOfTwo(MaxDecimation), "Decimation steps are powers of two.");
+
+        // Main loop, 'decimation' is rounded down to a power of two and is the finest the stream falls back to
+        static void Start(uint16_t const decimation) noexcept
+        {
+            s_active = false;
+            __DMB();
+
+            uint16_t step{ 1u };
+            while ((step < MaxDecimation) && ((step << 1u) <= decimation)) { step <<= 1u; }
+
+            s_minimum = step;
+            s_target = step;
+            s_decimation = step;
+            s_phase = 0u;
+            s_sum = Sample64{};
+            s_fill = 0u;
+            s_index = 0u;
+            s_discard = false;
+            s_dropped = 0u;
+            s_frames = 0u;
+            s_read = s_written;
+            s_pending = Telemetry::Frame{};
+            s_buffer.Release();
+            s_seenDropped = 0u;
+            s_seenWritten = s_written;
+            s_calm = 0u;
+
+            __DMB();
+            s_active = true;
+        }
+        static void Stop() noexcept
+        {
+            s_active = false;
+        }
+        static StreamStatus Status() noexcept
+        {
+            return StreamStatus{ s_active, s_target, s_frames, s_dropped };
+        }
+
+        // Acquisition interrupt, one processed block in fine units. A frame holds one mode, a partly filled one is
+        // abandoned when the mode changes and the index carries on.
+        static void Record(Common::Containers::Span<int32_t const> voltage, Common::Containers::Span<int32_t const> current, uint8_t const mode) noexcept
+        {
+            if (!s_active) { return; }
+
+            if ((mode != s_mode) && ((s_fill != 0u) || (s_phase != 0u)))
+            {
+                s_sum = Sample64{};
+                s_phase = 0u;
+                s_fill = 0u;
+            }
+
+            for (std::size_t i = 0; i < voltage.size(); ++i, ++s_index)
+            {
+                if ((s_fill == 0u) && (s_phase == 0u)) { Open(mode); }
+
+                s_sum.Voltage += voltage[i];
+                s_sum.Current += current[i];
+                if (++s_phase < s_decimation) { continue; }
+
+                if (!s_discard)
+                {
+                    s_slots[s_written & (Slots - 1u)].Samples[s_fill] = Sample{ static_cast<int32_t>(s_sum.Voltage >> s_shift), static_cast<int32_t>(s_sum.Current >> s_shift) };
+                }
+                s_sum = Sample64{};
+                s_phase = 0u;
+
+                if (++s_fill == SamplesPerFrame) { Close(); }
+            }
+        }
+
+        // Idle task, never waits on the link
+        template <typename tSerial>
+        static void Poll(tSerial & serial) noexcept
+        {
+            if (!s_active) { return; }
+
+            Adapt(serial);
+
+            while (true)
+            {
+                if (s_pending.empty())
+                {
+                    if (s_read == s_written) { return; }
+
+                    s_buffer = Telemetry::Claim(serial);
+                    if (!s_buffer) { return; } // Every frame buffer is queued or on the wire
+
+                    Slot const & slot{ s_slots[s_read & (Slots - 1u)] };
+                    s_pending = Telemetry::Encode
+                    (
+                        *s_buffer,
+                        MessageType::Stream,
+                        slot.Header,
+                        Telemetry::Bytes{ reinterpret_cast<uint8_t const *>(slot.Samples.data()), sizeof(slot.Samples) }
+                    );
+
+                    __DMB();
+                    s_read = s_read + 1u; // The samples are in the frame now, the interrupt may refill the slot
+                }
+
+                if (!Telemetry::Submit(serial, s_buffer, s_pending)) { return; } // DMA queue full, retried on the next pass
+
+                s_frames = s_frames + 1u;
+                s_pending = Telemetry::Frame{};
+            }
+        }
+
+    private:
+        struct Sample64
+        {
+            int64_t Voltage;
+            int64_t Current;
+        };
+        struct Slot
+        {
+            StreamHeader Header;
+            std::array<Sample, SamplesPerFrame> Samples;
+        };
+
+        static constexpr uint32_t CalmFrames = 16u;
+
+        // The decimation only changes on frame boundaries so every frame carries one rate
+        ALWAYS_INLINE
+        static void Open(uint8_t const mode) noexcept
+        {
+            s_mode = mode;
+            s_decimation = s_target;
+            s_shift = Common::Math::Log2(s_decimation);
+            s_discard = ((s_written - s_read) == Slots);
+
+            if (!s_discard)
+            {
+                s_slots[s_written & (Slots - 1u)].Header = StreamHeader{ s_index, s_dropped, s_decimation, mode, Constants::SampleFineBits };
+            }
+        }
+        ALWAYS_INLINE
+        static void Close() noexcept
+        {
+            s_fill = 0u;
+            if (s_discard)
+            {
+                s_dropped = s_dropped + 1u;
+                return;
+            }
+
+            __DMB();
+            s_written = s_written + 1u;
+        }
+        // Drops or a queue more than half full mean the link cannot keep up, a run of frames that found the link
+        // idle means it has room
+        template <typename tSerial>
+        static void Adapt(tSerial & serial) noexcept
+        {
+            uint32_t const dropped{ s_dropped };
+            uint32_t const written{ s_written };
+            uint32_t const backlog{ written - s_read };
+
+            // Judged once per frame produced or dropped, not per pass of the main loop
+            if ((written == s_seenWritten) && (dropped == s_seenDropped)) { return; }
+            s_seenWritten = written;
+
+            if ((dropped != s_seenDropped) || (backlog > (Slots / 2u)))
+            {
+                s_seenDropped = dropped;
+                s_calm = 0u;
+                if (s_target < MaxDecimation)
+                {
+                    s_target = static_cast<uint16_t>(s_target << 1u);
+                    LOG("stream: backlog %u, decimation %u", backlog, s_target);
+                }
+            }
+            else if ((backlog <= 1u) && serial.Idle() && (++s_calm >= CalmFrames))
+            {
+                s_calm = 0u;
+                if (s_target > s_minimum) { s_target = static_cast<uint16_t>(s_target >> 1u); }
+            }
+        }
+
+    private:
+        // Interrupt side
+        inline static std::array<Slot, Slots> s_slots{};
+        inline static Sample64 s_sum{};
+        inline static uint32_t s_phase{ 0 };
+        inline static uint16_t s_decimation{ 1 };
+        inline static uint8_t s_mode{ 0 };
+        inline static unsigned s_shift{ 0 };
+        inline static std::size_t s_fill{ 0 };
+        inline static uint32_t s_index{ 0 };
+        inline static bool s_discard{ false };
+        inline static uint32_t volatile s_written{ 0 };
+        inline static uint32_t volatile s_dropped{ 0 };
+
+        // Idle task side
+        inline static Telemetry::Buffer s_buffer{};
+        inline static Telemetry::Frame s_pending{};
+        inline static uint32_t volatile s_read{ 0 };
+        inline static uint32_t s_frames{ 0 };
+        inline static uint32_t s_seenDropped{ 0 };
+        inline static uint32_t s_seenWritten{ 0 };
+        inline static uint32_t s_calm{ 0 };
+        inline static uint16_t volatile s_target{ 1 };
+        inline static uint16_t s_minimum{ 1 };
+        inline static bool volatile s_active{ false };
+    };
+}
\ No newline at end of file
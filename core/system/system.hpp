@@ -3,12 +3,20 @@
 #include "types.hpp"
 #include "constants.hpp"
 #include "serial.hpp"
+#include "acquisition.hpp"
+#include "regulator.hpp"
+#include "commands.hpp"
+#include "log.hpp"
 
 #include "mcu/gpio.hpp"
 #include "mcu/rcc.hpp"
 #include "mcu/sys_tick.hpp"
+#include "mcu/cycle_counter.hpp"
+
+#include "printf/line_output.hpp"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace System
 {
@@ -47,28 +55,50 @@ namespace System
         }
         static auto & Serial() noexcept
         {
-            static auto serial
-            {
-                System::Serial<Core>
-                (
-                    &StatusGood,
-                    &StatusBad
-                )
-            };
+            static auto serial{ System::Serial<&Commands::Feed>() };
             return serial;
         }
+        // printf_ from the main loop, lines go to the TX DMA as they complete
+        static auto & Console() noexcept
+        {
+            using serial_t = std::remove_reference_t<decltype(Serial())>;
+            using console_t = Printf::LineOutput<serial_t, MCU::TRACE::CycleCounter, SystemBus_t::SystemClockFreq() / 1'000u * Constants::ConsoleWait>;
+
+            static console_t console{};
+            return console;
+        }
+        // Main loop work that must not run in interrupt context
+        static void Poll() noexcept
+        {
+            Commands::Process(Serial());
+            Link::Poll(Serial(), Ticks());
+            Stream::Poll(Serial());
+            Log::Poll(Serial());
+        }
+        static auto & Acquisition() noexcept
+        {
+            static System::Acquisition acquisition{};
+            return acquisition;
+        }
+        static auto & Regulator() noexcept
+        {
+            static System::Regulator regulator{};
+            return regulator;
+        }
 
     private:
         struct CoreModules
         {
+            BoardPins boardPins;
             SystemBus_t sysBus;
             SystemTick_t sysTick;
-            Pins::STATUS_LED statusLED;
+            BoardPins::Pin<Pins::STATUS_LED> statusLED;
 
             CoreModules() noexcept :
+                boardPins{},
                 sysBus{},
                 sysTick{ SystemBus_t::SystemClockFreq(), 1_KHz },
-                statusLED{ MCU::IO::Output::PushPull, MCU::IO::State::High }
+                statusLED{}
             {}
         };
 
@@ -79,7 +109,11 @@ namespace System
     {
         Core sys_core;
         auto & serial{ sys_core.Serial() };
+        auto & acquisition{ sys_core.Acquisition() };
+        auto & regulator{ sys_core.Regulator() };
         ((void)serial);
+        ((void)acquisition);
+        ((void)regulator);
         return sys_core;
     }
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "constants.hpp"
+
+#include "mcu/crc.hpp"
+
+#include "common/pool.hpp"
+#include "common/protocol/frame.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace System
+{
+    enum class MessageType : uint8_t
+    {
+        CaptureHeader = 0x01,
+        CaptureData = 0x02,
+        Stream = 0x10,
+        Log = 0x20
+    };
+
+    // Binary frames on the serial link: COBS stuffed, typed, numbered and checked by the CRC unit. Frames are encoded
+    // straight into blocks of one pool shared by every sender and the TX DMA reads them from there, a block returns to
+    // the pool once its frame has left. The sequence number is shared by every message type, a gap on the host means
+    // a lost frame.
+    class Telemetry
+    {
+    public:
+        using Checksum = MCU::CRC32::Module;
+        using Writer = Common::Protocol::FrameWriter<Checksum, Constants::TelemetryPayload>;
+        using Bytes = Writer::Bytes;
+        using Frame = Common::Containers::Span<uint8_t>;
+        using Pool = Common::Pool<Writer::Buffer, Constants::TelemetryBuffers>;
+        using Buffer = Pool::Handle;
+
+        static constexpr std::size_t MaxPayload = Writer::MaxPayload;
+
+        // Main loop only, the CRC unit and the bookkeeping are not shared with interrupts. Blocks until queued.
+        template <typename tSerial>
+        static void Send(tSerial & serial, MessageType const type, Bytes payload) noexcept
+        {
+            do
+            {
+                std::size_t const size{ (payload.size() < MaxPayload) ? payload.size() : MaxPayload };
+
+                Buffer buffer{ Claim(serial) };
+                while (!buffer) { buffer = Claim(serial); }
+
+                Frame const frame{ Encode(*buffer, type, payload.first(size)) };
+                while (!Submit(serial, buffer, frame)) {}
+
+                payload = payload.subspan(size);
+            }
+            while (!payload.empty());
+        }
+        // Returns the blocks of frames that have left to the pool, then takes one. Empty while every block is queued
+        // or on the wire.
+        template <typename tSerial>
+        static Buffer Claim(tSerial & serial) noexcept
+        {
+            for (InFlight & flight : s_inFlight)
+            {
+                if (flight.Block && (static_cast<int32_t>(serial.Sent() - flight.Ticket) >= 0)) { flight.Block.Release(); }
+            }
+            return s_pool.Allocate();
+        }
+        // Queues 'frame', encoded into 'buffer', and takes the buffer over until the frame has left. False when the
+        // transmit queue is full, the caller keeps the buffer and may retry.
+        template <typename tSerial>
+        static bool Submit(tSerial & serial, Buffer & buffer, Frame frame) noexcept
+        {
+            if (!serial.Write(Common::Containers::Span<char const>{ reinterpret_cast<char const *>(frame.data()), frame.size() })) { return false; }
+
+            uint32_t const ticket{ serial.Queued() };
+            for (InFlight & flight : s_inFlight)
+            {
+                if (!flight.Block)
+                {
+                    flight.Block = std::move(buffer);
+                    flight.Ticket = ticket;
+                    break;
+                }
+            }
+            return true;
+        }
+        // Encodes into a caller owned buffer and leaves sending to the caller, 'parts' are concatenated into one payload
+        template <typename... tParts>
+        static Frame Encode(Writer::Buffer & buffer, MessageType const type, tParts const & ... parts) noexcept
+        {
+            Unit();
+
+            Writer writer{ buffer, Common::Protocol::FrameHeader{ Common::Tools::EnumValue(type), s_sequence++ } };
+            ( writer.Append(parts), ... );
+            return writer.Finish();
+        }
+        [[nodiscard]]
+        static uint8_t Sequence() noexcept
+        {
+            return s_sequence;
+        }
+        [[nodiscard]]
+        static Common::PoolStatistics Buffers() noexcept
+        {
+            return s_pool.Statistics();
+        }
+
+    private:
+        // Every queued frame holds a block, so there is always a free entry
+        struct InFlight
+        {
+            Buffer Block;
+            uint32_t Ticket;
+        };
+
+        static void Unit() noexcept
+        {
+            static Checksum crc{};
+            ((void)crc);
+        }
+
+    private:
+        inline static Pool s_pool{};
+        inline static std::array<InFlight, Constants::TelemetryBuffers> s_inFlight{};
+        inline static uint8_t s_sequence{ 0 };
+    };
+}
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include "mcu/gpio.hpp"
 #include "mcu/spi.hpp"
 #include "mcu/usart.hpp"
+#include "mcu/auto_baud.hpp"
+#include "mcu/tim.hpp"
+#include "mcu/adc.hpp"
 #include "mcu/sys_tick.hpp"
 
 namespace System 
@@ -24,7 +27,63 @@ namespace System
     using SystemBus_t = CLK::SystemBus<BusProperties>;
     using SystemTick_t = SYSTICK::Module;
 
-    using SerialProperties = USART::Properties<USART::Peripheral::USART_1, Pins::USART_TX, Pins::USART_RX, SystemBus_t::APB2_ClockFreq(), 19200_u32>;
+    // Every pin the board drives, applied once at boot. Drivers take their pins through BoardPins::Pin so they do not
+    // configure them a second time.
+    using BoardPins = IO::PinMap< IO::Claim<Pins::STATUS_LED, IO::Output::PushPull, IO::State::High>,
+                                  IO::Claim<Pins::DAC_SYNC, IO::Output::PushPull, IO::OutputSpeed::_50MHz, IO::State::High>,
+                                  IO::Claim<Pins::VOLTAGE_SENSE, IO::Input::Analog>,
+                                  IO::Claim<Pins::CURRENT_SENSE, IO::Input::Analog>,
+                                  IO::Claim<Pins::USART_TX, IO::Alternate::PushPull>,
+                                  IO::Claim<Pins::USART_RX, IO::PullResistor::PullUp, IO::Input::PuPd>,
+                                  IO::Claim<Pins::SPI1_SCLK, IO::Alternate::PushPull, IO::OutputSpeed::_50MHz>,
+                                  IO::Claim<Pins::SPI1_MOSI, IO::Alternate::PushPull, IO::OutputSpeed::_50MHz> >;
 
-    using ExADC_Properties = SPI::Configuration<SPI::PeripheralID::SPI_1, Pins::SPI1_SCLK, Pins::SPI1_MOSI, IO::NoPin>;
+    // The handshake lines stay unclaimed until FlowControl::CTS_RTS is selected for a bridge that wires them
+    using SerialProperties = USART::Properties< USART::Peripheral::USART_1, 
+                                                BoardPins::Pin<Pins::USART_TX>, 
+                                                BoardPins::Pin<Pins::USART_RX>, 
+                                                SystemBus_t::APB2_ClockFreq(), 
+                                                19200_u32,
+                                                USART::DataDirection::TxRx,
+                                                USART::DataWidth::_8bits,
+                                                USART::Parity::None,
+                                                USART::StopBits::_1bit,
+                                                USART::FlowControl::None,
+                                                USART::TransferMode::DMA,
+                                                USART::TransferMode::DMA,
+                                                20000u,
+                                                Pins::USART_CTS,
+                                                Pins::USART_RTS >;
+
+    // USART1 RX (PA10) doubles as TIM1_CH3
+    using SerialAutoBaud = USART::AutoBaud<TIM::Peripheral::TIM_1, 3u, SystemBus_t::APB2_TimerClockFreq()>;
+
+    using ExADC_Properties = SPI::Configuration<SPI::PeripheralID::SPI_1, BoardPins::Pin<Pins::SPI1_SCLK>, BoardPins::Pin<Pins::SPI1_MOSI>, IO::NoPin>;
+
+    using DAC_Properties = SPI::Configuration< SPI::PeripheralID::SPI_1, 
+                                               BoardPins::Pin<Pins::SPI1_SCLK>, 
+                                               BoardPins::Pin<Pins::SPI1_MOSI>, 
+                                               IO::NoPin,
+                                               SPI::Mode::Master, 
+                                               SPI::BitOrder::MSB_First, 
+                                               SPI::DataWidth::_16bit,
+                                               SPI::ClockPhase::TrailingEdge, 
+                                               SPI::ClockPolarity::Low, 
+                                               SPI::ClockPrescaler::Div2,
+                                               SPI::DataDirection::FullDuplex,
+                                               Constants::ControlPriority >;
+
+    // TIM3 paces ADC1 through TRGO, each trigger converts voltage then current into the acquisition DMA buffer
+    using AcquisitionTimer = TIM::Properties<TIM::Peripheral::TIM_3, SystemBus_t::APB1_TimerClockFreq(), Constants::SampleRate>;
+
+    using AcquisitionProperties = ADC::Properties< ADC::Peripheral::ADC_1,
+                                                   SystemBus_t::ADC_ClockFreq(),
+                                                   Constants::SampleRate,
+                                                   ADC::Trigger::TIM3_TRGO,
+                                                   ADC::SampleTime::_28_5,
+                                                   Constants::AcquisitionBlockSize,
+                                                   Constants::AcquisitionPriority,
+                                                   0u, 1u >;
+
+    using RegulatorTimer = TIM::Properties<TIM::Peripheral::TIM_2, SystemBus_t::APB1_TimerClockFreq(), Constants::RegulatorRate, Constants::ControlPriority>;
 }
\ No newline at end of file
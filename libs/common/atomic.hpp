@@ -0,0 +1,109 @@
+#pragma once
+
+#include "macros.h"
+
+#include "cmsis_compiler.h"
+
+#include <cstdint>
+
+namespace Common
+{
+    // Masks every interrupt while in scope and restores the previous mask, so sections nest
+    class CriticalSection
+    {
+    public:
+        CriticalSection() noexcept
+            : m_primask{ __get_PRIMASK() }
+        {
+            __disable_irq();
+        }
+        ~CriticalSection() noexcept
+        {
+            __set_PRIMASK(m_primask);
+        }
+        CriticalSection(CriticalSection const &) = delete;
+        CriticalSection & operator = (CriticalSection const &) = delete;
+
+    private:
+        uint32_t const m_primask;
+    };
+
+    // Read-modify-write of a word in RAM that an interrupt cannot tear. It goes through the exclusive monitor:
+    // exception entry clears it, so an interrupted update retries instead of overwriting what the interrupt wrote,
+    // and nothing is masked. The F1 bus matrix has no exclusive support for peripherals. Their single bit fields are
+    // written through the bit-band alias by Bitfield, anything wider shared with an interrupt needs a CriticalSection.
+    namespace Atomic
+    {
+        // Stores operation(value) and returns it
+        template <typename tOperation>
+        ALWAYS_INLINE
+        uint32_t Modify(uint32_t volatile & value, tOperation && operation) noexcept
+        {
+            uint32_t result;
+            do { result = operation(__LDREXW(&value)); } while (__STREXW(result, &value) != 0u);
+            return result;
+        }
+        // 'operation' takes the current value and sets 'next', returning false leaves the value alone
+        template <typename tOperation>
+        ALWAYS_INLINE
+        bool ModifyIf(uint32_t volatile & value, tOperation && operation) noexcept
+        {
+            uint32_t next;
+            do
+            {
+                if (!operation(__LDREXW(&value), next))
+                {
+                    __CLREX();
+                    return false;
+                }
+            }
+            while (__STREXW(next, &value) != 0u);
+            return true;
+        }
+        // Returns the new value
+        ALWAYS_INLINE
+        uint32_t Add(uint32_t volatile & value, int32_t const delta) noexcept
+        {
+            return Modify(value, [delta](uint32_t const current) noexcept { return current + static_cast<uint32_t>(delta); });
+        }
+        // Returns the previous value
+        ALWAYS_INLINE
+        uint32_t Exchange(uint32_t volatile & value, uint32_t const desired) noexcept
+        {
+            uint32_t previous;
+            do { previous = __LDREXW(&value); } while (__STREXW(desired, &value) != 0u);
+            return previous;
+        }
+        ALWAYS_INLINE
+        bool CompareExchange(uint32_t volatile & value, uint32_t const expected, uint32_t const desired) noexcept
+        {
+            return ModifyIf(value, [=](uint32_t const current, uint32_t & next) noexcept
+            {
+                next = desired;
+                return (current == expected);
+            });
+        }
+        // Pointers are one word on the M3
+        template <typename T>
+        ALWAYS_INLINE
+        bool CompareExchange(T * volatile & value, T * const expected, T * const desired) noexcept
+        {
+            return CompareExchange
+            (
+                reinterpret_cast<uint32_t volatile &>(value),
+                static_cast<uint32_t>(reinterpret_cast<uintptr_t>(expected)),
+                static_cast<uint32_t>(reinterpret_cast<uintptr_t>(desired))
+            );
+        }
+        // Raises 'value' to 'level', false when it was already there
+        ALWAYS_INLINE
+        bool Max(uint32_t volatile & value, uint32_t const level) noexcept
+        {
+            return ModifyIf(value, [level](uint32_t const current, uint32_t & next) noexcept
+            {
+                next = level;
+                return (level > current);
+            });
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+#pragma once
+
+#include "common/command/parser.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Common::Command
+{
+    constexpr bool IsVowel(char const c) noexcept
+    {
+        switch (ToUpper(c))
+        {
+            case 'A':
+            case 'E':
+            case 'I':
+            case 'O':
+            case 'U': return true;
+            default: return false;
+        }
+    }
+
+    // Passes 'text' to 'out' one character at a time, upper-cased and with every header node cut to its SCPI short
+    // form: the first four letters, three when the fourth is a vowel. Nodes of four letters or fewer, common commands
+    // ('*IDN?') and a trailing '?' are kept as they are. Any spelling of a node, short or long, folds the same way.
+    template <typename tText, typename tOut>
+    constexpr void Fold(tText text, tOut && out) noexcept
+    {
+        size_t first{ 0 };
+        while (first < text.size())
+        {
+            size_t last{ first };
+            while ((last < text.size()) && (text[last] != ':')) { ++last; }
+
+            bool const query{ (last > first) && (text[last - 1u] == '?') };
+            size_t length{ last - first - (query ? 1u : 0u) };
+            if ((length > 4u) && (text[first] != '*')) { length = IsVowel(text[first + 3u]) ? 3u : 4u; }
+
+            for (size_t i = 0; i < length; ++i) { out(ToUpper(text[first + i])); }
+            if (query) { out('?'); }
+            if (last < text.size()) { out(':'); }
+            first = last + 1u;
+        }
+    }
+
+    // FNV-1a over the folded text
+    template <typename tText>
+    constexpr uint32_t Hash(tText text) noexcept
+    {
+        uint32_t hash{ 2166136261u };
+        Fold(text, [&hash](char const c) noexcept
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        });
+        return hash;
+    }
+
+    // 'name' spells every node of 'pattern' in its short or its long form, in any case. The short form is the
+    // pattern node without its lower-case letters.
+    template <typename tText>
+    constexpr bool Matches(tText name, std::string_view const pattern) noexcept
+    {
+        size_t n{ 0 };
+        size_t p{ 0 };
+        while (true)
+        {
+            size_t n_end{ n };
+            while ((n_end < name.size()) && (name[n_end] != ':')) { ++n_end; }
+            size_t p_end{ p };
+            while ((p_end < pattern.size()) && (pattern[p_end] != ':')) { ++p_end; }
+
+            bool is_short{ true };
+            size_t i{ n };
+            for (size_t j = p; j < p_end; ++j)
+            {
+                if ((pattern[j] >= 'a') && (pattern[j] <= 'z')) { continue; }
+                is_short = is_short && (i < n_end) && (ToUpper(name[i]) == pattern[j]);
+                ++i;
+            }
+            is_short = is_short && (i == n_end);
+
+            bool is_long{ (n_end - n) == (p_end - p) };
+            for (size_t j = 0; is_long && (j < (p_end - p)); ++j) { is_long = (ToUpper(name[n + j]) == ToUpper(pattern[p + j])); }
+
+            if (!is_short && !is_long) { return false; }
+
+            bool const name_done{ n_end == name.size() };
+            bool const pattern_done{ p_end == pattern.size() };
+            if (name_done || pattern_done) { return (name_done && pattern_done); }
+
+            n = n_end + 1u;
+            p = p_end + 1u;
+        }
+    }
+
+    // SCPI pattern, the upper-case letters are the short form of each node: "SOURce:VOLTage" answers to "SOUR:VOLT",
+    // "SOURCE:volt" or any other mix. The short forms have to follow the rule Fold() applies, Valid() checks that.
+    // Captureless lambdas convert to the handler, so the table holds plain pointers.
+    template <typename tResponse>
+    struct Command
+    {
+        using Handler = void(*)(Arguments &, tResponse &);
+
+        std::string_view Pattern;
+        Handler Function;
+    };
+
+    template <size_t tMaxName>
+    struct Name
+    {
+        std::array<char, tMaxName> Text{};
+        size_t Length{ 0 };
+
+        constexpr size_t size() const noexcept { return Length; }
+        constexpr char operator[](size_t const i) const noexcept { return Text[i]; }
+
+        constexpr bool operator==(Name const & other) const noexcept
+        {
+            if (Length != other.Length) { return false; }
+            for (size_t i = 0; (i < Length) && (i < tMaxName); ++i)
+            {
+                if (Text[i] != other.Text[i]) { return false; }
+            }
+            return true;
+        }
+    };
+
+    template <size_t tMaxName>
+    consteval Name<tMaxName> Folded(std::string_view const pattern) noexcept
+    {
+        Name<tMaxName> name{};
+        Fold(pattern, [&name](char const c)
+        {
+            if (name.Length < tMaxName) { name.Text[name.Length] = c; }
+            ++name.Length;
+        });
+        return name;
+    }
+    // The pattern's own short form, its lower-case letters dropped
+    template <size_t tMaxName>
+    consteval Name<tMaxName> Short(std::string_view const pattern) noexcept
+    {
+        Name<tMaxName> name{};
+        for (char const c : pattern)
+        {
+            if ((c >= 'a') && (c <= 'z')) { continue; }
+            if (name.Length < tMaxName) { name.Text[name.Length] = c; }
+            ++name.Length;
+        }
+        return name;
+    }
+
+    // Minimal perfect hash: one slot per pattern keyed by its folded short form, and a displacement per bucket chosen
+    // at compile time so no two patterns share a slot. A lookup is one hash of the folded name, one displacement read
+    // and a node by node compare with the only candidate.
+    template <typename tResponse, size_t tKeys, size_t tMaxName = 32u>
+    class HashTable
+    {
+    public:
+        using Handler = typename Command<tResponse>::Handler;
+
+        [[nodiscard]]
+        Handler Find(Token name) const noexcept
+        {
+            uint32_t const hash{ Hash(name) };
+            Slot const & slot{ m_slots[Index(hash, m_displacements[hash % tKeys])] };
+
+            return Matches(name, slot.Pattern) ? slot.Function : nullptr;
+        }
+        // False when two patterns fold to the same key, a short form breaks the folding rule, a name is too long or no
+        // displacement could be found
+        [[nodiscard]]
+        consteval bool Valid() const noexcept
+        {
+            return m_valid;
+        }
+
+        template <size_t tCommands>
+        static consteval HashTable Build(std::array<Command<tResponse>, tCommands> const & commands) noexcept
+        {
+            HashTable table{};
+            std::array<Name<tMaxName>, tKeys> keys{};
+
+            if (tCommands != tKeys) { return table; }
+            for (size_t k = 0; k < tKeys; ++k)
+            {
+                keys[k] = Folded<tMaxName>(commands[k].Pattern);
+                if ((keys[k].Length > tMaxName) || !(keys[k] == Short<tMaxName>(commands[k].Pattern))) { return table; }
+            }
+
+            for (size_t i = 0; i < tKeys; ++i)
+            {
+                for (size_t j = i + 1u; j < tKeys; ++j)
+                {
+                    if (keys[i] == keys[j]) { return table; }
+                }
+            }
+
+            // Fullest buckets first while there is still room to move them around
+            std::array<size_t, tKeys> sizes{};
+            std::array<size_t, tKeys> order{};
+            for (size_t i = 0; i < tKeys; ++i)
+            {
+                ++sizes[Hash(keys[i]) % tKeys];
+                order[i] = i;
+            }
+            for (size_t i = 0; i < tKeys; ++i)
+            {
+                for (size_t j = i + 1u; j < tKeys; ++j)
+                {
+                    if (sizes[order[j]] > sizes[order[i]])
+                    {
+                        size_t const swap{ order[i] };
+                        order[i] = order[j];
+                        order[j] = swap;
+                    }
+                }
+            }
+
+            std::array<bool, tKeys> taken{};
+            for (size_t const bucket : order)
+            {
+                if (sizes[bucket] == 0u) { break; }
+
+                bool placed{ false };
+                for (uint32_t displacement = 0; !placed && (displacement <= MaxDisplacement); ++displacement)
+                {
+                    std::array<bool, tKeys> trial{ taken };
+                    placed = true;
+
+                    for (size_t k = 0; placed && (k < tKeys); ++k)
+                    {
+                        uint32_t const hash{ Hash(keys[k]) };
+                        if ((hash % tKeys) != bucket) { continue; }
+
+                        size_t const index{ Index(hash, displacement) };
+                        placed = !trial[index];
+                        trial[index] = true;
+                    }
+
+                    if (placed)
+                    {
+                        taken = trial;
+                        table.m_displacements[bucket] = static_cast<uint16_t>(displacement);
+                    }
+                }
+                if (!placed) { return table; }
+            }
+
+            for (size_t k = 0; k < tKeys; ++k)
+            {
+                uint32_t const hash{ Hash(keys[k]) };
+                Slot & slot{ table.m_slots[Index(hash, table.m_displacements[hash % tKeys])] };
+                slot.Pattern = commands[k].Pattern;
+                slot.Function = commands[k].Function;
+            }
+            table.m_valid = true;
+            return table;
+        }
+
+    private:
+        static constexpr uint32_t MaxDisplacement = 0xFFFFu;
+
+        struct Slot
+        {
+            std::string_view Pattern{};
+            Handler Function{ nullptr };
+        };
+
+        // Murmur3 finaliser of the hash mixed with the displacement, spreads a bucket over the whole table
+        static constexpr size_t Index(uint32_t hash, uint32_t const displacement) noexcept
+        {
+            hash ^= (displacement * 0x9E3779B9u);
+            hash ^= (hash >> 16u);
+            hash *= 0x85EBCA6Bu;
+            hash ^= (hash >> 13u);
+            hash *= 0xC2B2AE35u;
+            hash ^= (hash >> 16u);
+            return (hash % tKeys);
+        }
+
+    private:
+        std::array<Slot, tKeys> m_slots{};
+        std::array<uint16_t, tKeys> m_displacements{};
+        bool m_valid{ false };
+    };
+
+    // One key per pattern
+    template <typename tResponse, size_t tCommands>
+    consteval size_t KeyCount(std::array<Command<tResponse>, tCommands> const &) noexcept
+    {
+        return tCommands;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "common/math.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Common::Command
+{
+    // Collects received bytes into lines. The interrupt side fills one slot while up to tSlots - 1 complete lines wait
+    // for the thread side, which parses each in place and releases it. A line arriving while every slot is taken is
+    // dropped as a whole and counted. One longer than tLineSize is handed over cut short and marked Truncated(), so
+    // the thread side can tell the sender instead of running half of it.
+    template <size_t tLineSize, size_t tSlots = 4u>
+    class LineAssembler
+    {
+    public:
+        using Line = Containers::Span<char const>;
+
+        static_assert(Math::IsPowerOfTwo(tSlots) && (tSlots > 1u), "Slot count must be a power of two above one.");
+
+        // Interrupt side
+        void Feed(Containers::Span<char const> data) noexcept
+        {
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                char const c{ data[i] };
+                if ((c == '\r') || (c == '\n'))
+                {
+                    Complete();
+                }
+                else if (m_length < tLineSize)
+                {
+                    m_lines[m_write & Mask][m_length++] = c;
+                }
+                else { m_truncated = true; }
+            }
+        }
+        // Thread side, oldest complete line first, valid until Release()
+        [[nodiscard]]
+        std::optional<Line> Take() const noexcept
+        {
+            uint32_t const read{ m_read };
+            if (read == m_write) { return {}; }
+            return Line{ m_lines[read & Mask].data(), m_lengths[read & Mask] };
+        }
+        // The line Take() returns lost everything past tLineSize
+        [[nodiscard]]
+        bool Truncated() const noexcept
+        {
+            return m_cut[m_read & Mask];
+        }
+        void Release() noexcept
+        {
+            m_read = m_read + 1u;
+        }
+        // Room for another complete line, the slot being filled takes the bytes still in flight after a hold
+        [[nodiscard]]
+        bool Ready() const noexcept
+        {
+            return (m_write - m_read) < Mask;
+        }
+        [[nodiscard]]
+        uint32_t Dropped() const noexcept
+        {
+            return m_dropped;
+        }
+
+    private:
+        static constexpr uint32_t Mask = tSlots - 1u;
+
+        void Complete() noexcept
+        {
+            if (m_length == 0u) { return; }
+
+            if ((m_write - m_read) >= Mask) { ++m_dropped; }
+            else
+            {
+                m_lengths[m_write & Mask] = m_length;
+                m_cut[m_write & Mask] = m_truncated;
+                m_write = m_write + 1u;
+            }
+            m_length = 0u;
+            m_truncated = false;
+        }
+
+    private:
+        std::array<std::array<char, tLineSize>, tSlots> m_lines{};
+        std::array<size_t, tSlots> m_lengths{};
+        std::array<bool, tSlots> m_cut{};
+        size_t m_length{ 0 };
+        bool m_truncated{ false };
+        uint32_t volatile m_write{ 0 };
+        uint32_t volatile m_read{ 0 };
+        uint32_t m_dropped{ 0 };
+    };
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "common/math.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace Common::Command
+{
+    using Token = Containers::Span<char const>;
+
+    constexpr bool IsSeparator(char const c) noexcept
+    {
+        return ((c == ' ') || (c == '\t') || (c == ','));
+    }
+    constexpr char ToUpper(char const c) noexcept
+    {
+        return ((c >= 'a') && (c <= 'z')) ? static_cast<char>(c - ('a' - 'A')) : c;
+    }
+    // Case-insensitive, command names are matched the way SCPI does
+    inline bool Equal(Token lhs, std::string_view const rhs) noexcept
+    {
+        if (lhs.size() != rhs.size()) { return false; }
+        for (size_t i = 0; i < rhs.size(); ++i)
+        {
+            if (ToUpper(lhs[i]) != ToUpper(rhs[i])) { return false; }
+        }
+        return true;
+    }
+    inline Token Trim(Token input) noexcept
+    {
+        size_t first{ 0 };
+        size_t last{ input.size() };
+        while ((first < last) && IsSeparator(input[first])) { ++first; }
+        while ((last > first) && IsSeparator(input[last - 1u])) { --last; }
+        return input.subspan(first, last - first);
+    }
+    // Position of the first 'c' in 'input', size() when there is none
+    inline size_t Find(Token input, char const c) noexcept
+    {
+        size_t i{ 0 };
+        while ((i < input.size()) && (input[i] != c)) { ++i; }
+        return i;
+    }
+
+    // Optional sign followed by decimal digits, nothing else
+    inline std::optional<int32_t> ParseInteger(Token input) noexcept
+    {
+        if (input.empty()) { return {}; }
+
+        bool const negative{ input[0] == '-' };
+        size_t i{ ((input[0] == '-') || (input[0] == '+')) ? 1u : 0u };
+        if (i == input.size()) { return {}; }
+
+        int64_t value{ 0 };
+        for (; i < input.size(); ++i)
+        {
+            char const c{ input[i] };
+            if ((c < '0') || (c > '9')) { return {}; }
+
+            value = (value * 10) + (c - '0');
+            if (value > (int64_t{ std::numeric_limits<int32_t>::max() } + 1)) { return {}; }
+        }
+
+        value = negative ? -value : value;
+        if (value > std::numeric_limits<int32_t>::max()) { return {}; }
+        return static_cast<int32_t>(value);
+    }
+    // Decimal text scaled by 10^decimals, "1.25" with 3 decimals is 1250. Digits past 'decimals' are truncated.
+    inline std::optional<int32_t> ParseDecimal(Token input, unsigned const decimals) noexcept
+    {
+        constexpr int64_t limit{ int64_t{ std::numeric_limits<int32_t>::max() } + 1 };
+
+        if (input.empty()) { return {}; }
+
+        bool const negative{ input[0] == '-' };
+        size_t i{ ((input[0] == '-') || (input[0] == '+')) ? 1u : 0u };
+
+        int64_t value{ 0 };
+        bool digits{ false };
+        bool point{ false };
+        unsigned places{ 0 };
+
+        for (; i < input.size(); ++i)
+        {
+            char const c{ input[i] };
+            if ((c == '.') && !point)
+            {
+                point = true;
+                continue;
+            }
+            if ((c < '0') || (c > '9')) { return {}; }
+
+            digits = true;
+            if (point)
+            {
+                if (places == decimals) { continue; }
+                ++places;
+            }
+
+            value = (value * 10) + (c - '0');
+            if (value > limit) { return {}; }
+        }
+        if (!digits) { return {}; }
+
+        for (; places < decimals; ++places)
+        {
+            value *= 10;
+            if (value > limit) { return {}; }
+        }
+
+        value = negative ? -value : value;
+        if (value > std::numeric_limits<int32_t>::max()) { return {}; }
+        return static_cast<int32_t>(value);
+    }
+
+    // Walks the argument text of one command, tokens are views into the received line
+    class Arguments
+    {
+    public:
+        explicit Arguments(Token text) noexcept
+            : m_text{ text }
+        {}
+
+        [[nodiscard]]
+        bool Empty() const noexcept
+        {
+            return m_text.empty();
+        }
+        [[nodiscard]]
+        Token Next() noexcept
+        {
+            m_text = Trim(m_text);
+
+            size_t end{ 0 };
+            while ((end < m_text.size()) && !IsSeparator(m_text[end])) { ++end; }
+
+            Token const token{ m_text.first(end) };
+            m_text = m_text.subspan(end);
+            return token;
+        }
+        [[nodiscard]]
+        std::optional<int32_t> Integer() noexcept
+        {
+            return ParseInteger(Next());
+        }
+        [[nodiscard]]
+        std::optional<int32_t> Decimal(unsigned const decimals) noexcept
+        {
+            return ParseDecimal(Next(), decimals);
+        }
+
+    private:
+        Token m_text;
+    };
+
+    // Runs every ';' separated command of a line in order, each one adds to 'response'. Returns the number of
+    // commands that were not found in the table.
+    template <typename tTable, typename tResponse>
+    size_t Execute(tTable const & table, Token line, tResponse & response) noexcept
+    {
+        size_t unknown{ 0 };
+
+        while (!line.empty())
+        {
+            size_t const end{ Find(line, ';') };
+            Token command{ Trim(line.first(end)) };
+            line = line.subspan(Common::Math::Minimum(end + 1u, line.size()));
+
+            if (command.empty()) { continue; }
+
+            size_t name_end{ 0 };
+            while ((name_end < command.size()) && !IsSeparator(command[name_end])) { ++name_end; }
+
+            Token const name{ command.first(name_end) };
+            Arguments arguments{ command.subspan(name_end) };
+
+            if (auto const handler{ table.Find(name) }; handler != nullptr)
+            {
+                handler(arguments, response);
+            }
+            else
+            {
+                response.Unknown(name);
+                ++unknown;
+            }
+        }
+        return unknown;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Common::Command
+{
+    // Fixed size reply text, formatted without printf. Anything past tSize is dropped and flagged.
+    template <size_t tSize>
+    class Response
+    {
+    public:
+        Response & Char(char const c) noexcept
+        {
+            if (m_size < tSize) { m_buffer[m_size++] = c; }
+            else { m_overflow = true; }
+            return *this;
+        }
+        Response & Text(std::string_view const text) noexcept
+        {
+            for (char const c : text) { Char(c); }
+            return *this;
+        }
+        // Copies received text, e.g. an unknown command name
+        Response & Append(Containers::Span<char const> text) noexcept
+        {
+            for (size_t i = 0; i < text.size(); ++i) { Char(text[i]); }
+            return *this;
+        }
+        Response & Integer(int64_t const value) noexcept
+        {
+            uint64_t magnitude{ (value < 0) ? (0u - static_cast<uint64_t>(value)) : static_cast<uint64_t>(value) };
+            if (value < 0) { Char('-'); }
+
+            std::array<char, 20> digits{};
+            size_t count{ 0 };
+            do
+            {
+                digits[count++] = static_cast<char>('0' + (magnitude % 10u));
+                magnitude /= 10u;
+            } while (magnitude != 0u);
+
+            while (count != 0u) { Char(digits[--count]); }
+            return *this;
+        }
+        // 'value' scaled by 10^decimals, printed with exactly 'decimals' places
+        Response & Decimal(int64_t const value, unsigned const decimals) noexcept
+        {
+            uint64_t scale{ 1 };
+            for (unsigned d = 0; d < decimals; ++d) { scale *= 10u; }
+
+            uint64_t const magnitude{ (value < 0) ? (0u - static_cast<uint64_t>(value)) : static_cast<uint64_t>(value) };
+            uint64_t fraction{ magnitude % scale };
+
+            if (value < 0) { Char('-'); }
+            Integer(static_cast<int64_t>(magnitude / scale));
+            if (decimals == 0u) { return *this; }
+
+            Char('.');
+            for (uint64_t place = scale / 10u; place != 0u; place /= 10u)
+            {
+                Char(static_cast<char>('0' + (fraction / place)));
+                fraction %= place;
+            }
+            return *this;
+        }
+        // Separates the replies of several commands on one line
+        Response & Separator() noexcept
+        {
+            if ((m_size != 0u) && (m_buffer[m_size - 1u] != ';')) { Char(';'); }
+            return *this;
+        }
+        Response & Unknown(Containers::Span<char const> name) noexcept
+        {
+            return Separator().Text("ERR ").Append(name);
+        }
+        void Clear() noexcept
+        {
+            m_size = 0u;
+            m_overflow = false;
+        }
+        [[nodiscard]]
+        bool Empty() const noexcept
+        {
+            return (m_size == 0u);
+        }
+        [[nodiscard]]
+        bool Overflow() const noexcept
+        {
+            return m_overflow;
+        }
+        [[nodiscard]]
+        Containers::Span<char const> View() const noexcept
+        {
+            return Containers::Span<char const>{ m_buffer.data(), m_size };
+        }
+
+    private:
+        std::array<char, tSize> m_buffer{};
+        size_t m_size{ 0 };
+        bool m_overflow{ false };
+    };
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "common/containers/span.hpp"
+
 #include <array>
 #include <cstddef>
 #include <optional>
@@ -37,6 +39,30 @@ namespace Common::Containers
             increment_read();
             return retval;
         }
+
+        // Contiguous access for DMA and bulk copies, bipartite buffer style: the regions stop at the end of the storage,
+        // so a transfer that wraps takes two rounds. Fill or drain the region, then commit what was actually used.
+        [[nodiscard]]
+        constexpr Span<T> WritableRegion() noexcept
+        {
+            SizeType const end{ (m_Write >= m_Read) ? ((m_Read == 0u) ? MaxSize : BufferSize) : (m_Read - 1u) };
+            return Span<T>{ m_Buffer.data() + m_Write, end - m_Write };
+        }
+        constexpr void CommitWrite(SizeType const count) noexcept
+        {
+            m_Write = advance(m_Write, count);
+        }
+        [[nodiscard]]
+        constexpr Span<T const> ReadableRegion() const noexcept
+        {
+            SizeType const end{ (m_Write >= m_Read) ? m_Write : BufferSize };
+            return Span<T const>{ m_Buffer.data() + m_Read, end - m_Read };
+        }
+        constexpr void ConsumeRead(SizeType const count) noexcept
+        {
+            m_Read = advance(m_Read, count);
+        }
+
         constexpr void Clear() noexcept
         {
             m_Write = m_Read = 0;
@@ -99,6 +125,13 @@ namespace Common::Containers
         {
             return (input % BufferSize);
         }
+        // Steps within one region never pass the end of the storage, so no division is needed
+        [[nodiscard]]
+        static constexpr SizeType advance(SizeType const index, SizeType const count) noexcept
+        {
+            SizeType const next{ index + count };
+            return (next >= BufferSize) ? (next - BufferSize) : next;
+        }
         constexpr SizeType push_impl(ConstReference input) noexcept
         {
             m_Buffer[m_Write] = input;
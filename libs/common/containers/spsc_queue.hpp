@@ -0,0 +1,122 @@
+#pragma once
+
+#include "common/containers/span.hpp"
+
+#include "cmsis_compiler.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Common::Containers
+{
+    // Single producer, single consumer queue for handing data between an interrupt and the main loop. Each side only
+    // writes its own index, the indices run freely and are masked into the buffer, so all N slots are usable and a
+    // full queue refuses instead of overwriting. The barrier between filling a slot and publishing the index makes the
+    // data visible before the other side can see it.
+    template <typename T, size_t N>
+    class SpscQueue
+    {
+    public:
+        using ValueType = T;
+        using SizeType = size_t;
+
+        static_assert((N != 0u) && ((N & (N - 1u)) == 0u), "Queue size must be a power of two.");
+
+        constexpr SpscQueue() noexcept = default;
+
+        // Producer side
+        bool TryPush(T const & input) noexcept
+        {
+            uint32_t const head{ m_head };
+            if ((head - m_tail) == N) { return false; }
+
+            m_buffer[head & Mask] = input;
+            __DMB();
+            m_head = head + 1u;
+            return true;
+        }
+        // Copies as much of 'input' as fits, returns the count
+        SizeType Write(Span<T const> input) noexcept
+        {
+            uint32_t const head{ m_head };
+            SizeType const count{ Min(input.size(), N - (head - m_tail)) };
+
+            for (SizeType i = 0; i < count; ++i) { m_buffer[(head + i) & Mask] = input[i]; }
+            __DMB();
+            m_head = head + count;
+            return count;
+        }
+
+        // Consumer side
+        std::optional<T> TryPop() noexcept
+        {
+            uint32_t const tail{ m_tail };
+            if (tail == m_head) { return {}; }
+
+            __DMB();
+            T const output{ m_buffer[tail & Mask] };
+            __DMB();
+            m_tail = tail + 1u;
+            return output;
+        }
+        // Fills 'output' from the oldest element on, returns the count
+        SizeType Read(Span<T> output) noexcept
+        {
+            uint32_t const tail{ m_tail };
+            SizeType const count{ Min(output.size(), m_head - tail) };
+
+            __DMB();
+            for (SizeType i = 0; i < count; ++i) { output[i] = m_buffer[(tail + i) & Mask]; }
+            __DMB();
+            m_tail = tail + count;
+            return count;
+        }
+        // Drops everything the producer has published so far
+        void Clear() noexcept
+        {
+            m_tail = m_head;
+        }
+
+        // Either side, a snapshot that the other side may change right after
+        [[nodiscard]]
+        SizeType Size() const noexcept
+        {
+            return (m_head - m_tail);
+        }
+        [[nodiscard]]
+        SizeType Available() const noexcept
+        {
+            return N - Size();
+        }
+        [[nodiscard]]
+        bool Empty() const noexcept
+        {
+            return (m_head == m_tail);
+        }
+        [[nodiscard]]
+        bool Full() const noexcept
+        {
+            return (Size() == N);
+        }
+        [[nodiscard]]
+        static constexpr SizeType Capacity() noexcept
+        {
+            return N;
+        }
+
+    private:
+        static constexpr uint32_t Mask = N - 1u;
+
+        static constexpr SizeType Min(SizeType const a, SizeType const b) noexcept
+        {
+            return (a < b) ? a : b;
+        }
+
+    private:
+        std::array<T, N> m_buffer{};
+        uint32_t volatile m_head{ 0 };  // Written by the producer only
+        uint32_t volatile m_tail{ 0 };  // Written by the consumer only
+    };
+}
\ No newline at end of file
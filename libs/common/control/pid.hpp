@@ -0,0 +1,100 @@
+#pragma once
+
+#include "common/math.hpp"
+
+#include <cstdint>
+
+namespace Common::Control
+{
+    // Fixed-point PID, gains carry tFracBits fractional bits while setpoint, measurement and output are plain counts.
+    // Every product is a 32x32->64 multiply-accumulate so the update maps onto SMULL/SMLAL without any division.
+    template <unsigned tFracBits = 16u>
+    class PID
+    {
+    public:
+        using ValueType = int32_t;
+        using AccumType = int64_t;
+
+        static constexpr ValueType One{ ValueType{1} << tFracBits };
+
+        struct Gains
+        {
+            ValueType Kp{ 0 };
+            ValueType Ki{ 0 };
+            ValueType Kd{ 0 };
+        };
+
+        constexpr PID() noexcept = default;
+        constexpr PID(Gains const gains, ValueType const out_min, ValueType const out_max) noexcept
+            : m_gains{ gains }
+            , m_min{ ToAccum(out_min) }
+            , m_max{ ToAccum(out_max) }
+        {}
+
+        constexpr void SetGains(Gains const gains) noexcept
+        {
+            m_gains = gains;
+        }
+        constexpr void SetLimits(ValueType const out_min, ValueType const out_max) noexcept
+        {
+            m_min = ToAccum(out_min);
+            m_max = ToAccum(out_max);
+            m_integral = Clamp(m_integral);
+        }
+        constexpr void Reset(ValueType const output = 0, ValueType const measurement = 0) noexcept
+        {
+            m_integral = Clamp(ToAccum(output));
+            m_feedForward = 0;
+            m_lastMeasurement = measurement;
+        }
+        // Back-calculation for bumpless transfer: preload the integrator so this loop would have produced 'output'
+        constexpr void Track(ValueType const output) noexcept
+        {
+            m_integral = Clamp(ToAccum(output) - m_feedForward);
+        }
+        constexpr ValueType Update(ValueType const setpoint, ValueType const measurement) noexcept
+        {
+            ValueType const error{ setpoint - measurement };
+
+            AccumType const proportional{ AccumType{ m_gains.Kp } * error };
+            AccumType const derivative{ AccumType{ m_gains.Kd } * (m_lastMeasurement - measurement) }; // On measurement, no setpoint kick
+            AccumType const integral{ Clamp(m_integral + (AccumType{ m_gains.Ki } * error)) };
+
+            m_lastMeasurement = measurement;
+            m_feedForward = proportional + derivative;
+
+            AccumType const sum{ m_feedForward + integral };
+
+            // Conditional integration: freeze the integrator while the output is saturated in the direction of the error
+            if (!(((sum > m_max) && (error > 0)) || ((sum < m_min) && (error < 0))))
+            {
+                m_integral = integral;
+            }
+
+            return static_cast<ValueType>(Clamp(sum) >> tFracBits);
+        }
+        [[nodiscard]]
+        constexpr ValueType Integral() const noexcept
+        {
+            return static_cast<ValueType>(m_integral >> tFracBits);
+        }
+
+    private:
+        static constexpr AccumType ToAccum(ValueType const input) noexcept
+        {
+            return (AccumType{ input } * One);
+        }
+        constexpr AccumType Clamp(AccumType const input) const noexcept
+        {
+            return Math::Minimum(Math::Maximum(input, m_min), m_max);
+        }
+
+    private:
+        Gains m_gains{};
+        AccumType m_min{ 0 };
+        AccumType m_max{ 0 };
+        AccumType m_integral{ 0 };
+        AccumType m_feedForward{ 0 };
+        ValueType m_lastMeasurement{ 0 };
+    };
+}
\ No newline at end of file
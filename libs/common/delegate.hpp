@@ -0,0 +1,145 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/static_lambda.hpp"
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace Common
+{
+    template <typename tSignature>
+    class Delegate;
+
+    // Non-owning callable reference, two words and trivially copyable. The target is called through a thunk that
+    // knows its type, an empty delegate calls a stub instead of testing for null. Whatever it refers to has to
+    // outlive it.
+    template <typename R, typename... tArgs>
+    class Delegate<R(tArgs...)>
+    {
+    public:
+        constexpr Delegate() noexcept = default;
+
+        // Any callable object, referenced not copied
+        template <typename tCallable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<tCallable>, Delegate> && std::is_invocable_r_v<R, tCallable &, tArgs...>>>
+        constexpr Delegate(tCallable & callable) noexcept
+            : m_context{ const_cast<void *>(static_cast<void const *>(std::addressof(callable))) }
+            , m_thunk{ &Object<tCallable> }
+        {}
+        // Function known at compile time, the thunk calls it directly
+        template <auto tFunction>
+        static constexpr Delegate Bind() noexcept
+        {
+            Delegate delegate{};
+            delegate.m_thunk = &Function<tFunction>;
+            return delegate;
+        }
+        // Member function known at compile time on 'object'
+        template <auto tMember, typename T>
+        static constexpr Delegate Bind(T & object) noexcept
+        {
+            Delegate delegate{};
+            delegate.m_context = const_cast<void *>(static_cast<void const *>(std::addressof(object)));
+            delegate.m_thunk = &Member<tMember, T>;
+            return delegate;
+        }
+
+        R operator()(tArgs... args) const
+        {
+            return m_thunk(m_context, std::forward<tArgs>(args)...);
+        }
+        [[nodiscard]]
+        constexpr bool Empty() const noexcept
+        {
+            return (m_thunk == &Nothing);
+        }
+
+    private:
+        using Thunk = R (*)(void *, tArgs...);
+
+        static R Nothing(void *, tArgs...)
+        {
+            if constexpr (!std::is_void_v<R>) { return R{}; }
+        }
+        template <typename tCallable>
+        static R Object(void * const context, tArgs... args)
+        {
+            return std::invoke(*static_cast<tCallable *>(context), std::forward<tArgs>(args)...);
+        }
+        template <auto tFunction>
+        static R Function(void *, tArgs... args)
+        {
+            return std::invoke(tFunction, std::forward<tArgs>(args)...);
+        }
+        template <auto tMember, typename T>
+        static R Member(void * const context, tArgs... args)
+        {
+            return std::invoke(tMember, *static_cast<T *>(context), std::forward<tArgs>(args)...);
+        }
+
+    private:
+        void * m_context{ nullptr };
+        Thunk m_thunk{ &Nothing };
+    };
+
+    // Static binding, the target is part of the type so a driver calling Run() inlines it completely. Takes a
+    // function pointer or a captureless lambda: Bound<&Commands::Feed>, Bound<[]() noexcept {}>.
+    template <auto tTarget>
+    struct Bound
+    {
+        template <typename... tArgs>
+        ALWAYS_INLINE
+        static decltype(auto) Run(tArgs && ... args) noexcept
+        {
+            return std::invoke(tTarget, std::forward<tArgs>(args)...);
+        }
+    };
+
+    // Keeps the delegate of a driver where its static interrupt handler can reach it. 'tOwner' gives each driver
+    // its own slot.
+    template <typename tDelegate, typename tOwner>
+    class DelegateSlot
+    {
+    public:
+        DelegateSlot() noexcept = default;
+        DelegateSlot(tDelegate const delegate) noexcept
+        {
+            s_delegate = delegate;
+        }
+
+        template <typename... tArgs>
+        ALWAYS_INLINE
+        static decltype(auto) Run(tArgs && ... args)
+        {
+            return s_delegate(std::forward<tArgs>(args)...);
+        }
+
+    private:
+        inline static tDelegate s_delegate{};
+    };
+
+    namespace Detail
+    {
+        template <typename T>
+        struct IsDelegate : std::false_type {};
+        template <typename tSignature>
+        struct IsDelegate<Delegate<tSignature>> : std::true_type {};
+
+        template <typename T>
+        struct IsBound : std::false_type {};
+        template <auto tTarget>
+        struct IsBound<Bound<tTarget>> : std::true_type {};
+    }
+
+    // How a driver holds the callback it was built with: a Bound target as is, a Delegate in a static slot and any
+    // other callable in a StaticLambda
+    template <typename tCallback, typename tOwner>
+    using CallbackFor = std::conditional_t
+    <
+        Detail::IsBound<tCallback>::value,
+        tCallback,
+        std::conditional_t<Detail::IsDelegate<tCallback>::value, DelegateSlot<tCallback, tOwner>, StaticLambda<tCallback>>
+    >;
+}
\ No newline at end of file
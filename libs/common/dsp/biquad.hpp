@@ -0,0 +1,138 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/math.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Common::DSP
+{
+    using q31_t = int32_t;
+
+    // Coefficients are Q2.30 so the |a1| close to 2 of a low corner or notch still fits. The feedback terms are stored
+    // negated so every tap of the recursion is a multiply-accumulate (SMULL/SMLAL) into the 64 bit state.
+    struct Biquad
+    {
+        q31_t B0{ 0 };
+        q31_t B1{ 0 };
+        q31_t B2{ 0 };
+        q31_t NegA1{ 0 };
+        q31_t NegA2{ 0 };
+    };
+
+    namespace Design
+    {
+        static constexpr unsigned CoefficientFracBits = 30u;
+
+        consteval q31_t ToQ30(double const value) noexcept
+        {
+            constexpr double scale{ static_cast<double>(1ull << CoefficientFracBits) };
+            double const scaled{ value * scale };
+            double const limited{ Math::Minimum(Math::Maximum(scaled, -2.0 * scale), (2.0 * scale) - 1.0) };
+            return static_cast<q31_t>(limited + ((limited < 0.0) ? -0.5 : 0.5));
+        }
+        consteval Biquad Normalize(double b0, double b1, double b2, double a0, double a1, double a2) noexcept
+        {
+            return Biquad{ ToQ30(b0 / a0), ToQ30(b1 / a0), ToQ30(b2 / a0), ToQ30(-a1 / a0), ToQ30(-a2 / a0) };
+        }
+
+        // RBJ audio cookbook forms
+        consteval Biquad LowPass(double const sample_rate, double const corner, double const q = 0.7071067811865476) noexcept
+        {
+            double const w0{ 2.0 * Math::Pi * corner / sample_rate };
+            double const cosw{ Math::Cosine(w0) };
+            double const alpha{ Math::Sine(w0) / (2.0 * q) };
+
+            return Normalize((1.0 - cosw) / 2.0, (1.0 - cosw), (1.0 - cosw) / 2.0, 1.0 + alpha, -2.0 * cosw, 1.0 - alpha);
+        }
+        consteval Biquad Notch(double const sample_rate, double const center, double const q = 10.0) noexcept
+        {
+            double const w0{ 2.0 * Math::Pi * center / sample_rate };
+            double const cosw{ Math::Cosine(w0) };
+            double const alpha{ Math::Sine(w0) / (2.0 * q) };
+
+            return Normalize(1.0, -2.0 * cosw, 1.0, 1.0 + alpha, -2.0 * cosw, 1.0 - alpha);
+        }
+    }
+
+    // Cascade of direct form II transposed sections shared by tChannels independent signals.
+    // State is laid out structure-of-arrays (stage major, channel minor) and kept at Q61 in 64 bits,
+    // so requantisation only happens once per section output. Inputs need one bit of headroom (|x| < 0.5).
+    template <size_t tStages, size_t tChannels = 1u>
+    class BiquadCascade
+    {
+    public:
+        using Coefficients = std::array<Biquad, tStages>;
+        using StateType = int64_t;
+
+        static constexpr size_t Stages = tStages;
+        static constexpr size_t Channels = tChannels;
+
+        constexpr BiquadCascade() noexcept = default;
+        constexpr explicit BiquadCascade(Coefficients const & coefficients) noexcept
+            : m_coefficients{ coefficients }
+        {}
+
+        constexpr void Reset() noexcept
+        {
+            for (auto & stage : m_s1) { stage.fill(0); }
+            for (auto & stage : m_s2) { stage.fill(0); }
+        }
+        // Filters one channel's block in place, e.g. one half of a DMA double buffer
+        void Process(size_t const channel, Containers::Span<q31_t> block) noexcept
+        {
+            for (size_t stage = 0; stage < tStages; ++stage)
+            {
+                ProcessStage(m_coefficients[stage], m_s1[stage][channel], m_s2[stage][channel], block.begin(), block.end());
+            }
+        }
+        [[nodiscard]]
+        q31_t Process(size_t const channel, q31_t sample) noexcept
+        {
+            for (size_t stage = 0; stage < tStages; ++stage)
+            {
+                ProcessStage(m_coefficients[stage], m_s1[stage][channel], m_s2[stage][channel], &sample, &sample + 1);
+            }
+            return sample;
+        }
+
+    private:
+        ALWAYS_INLINE
+        static q31_t Saturate(StateType const input) noexcept
+        {
+            StateType const shifted{ input >> Design::CoefficientFracBits };
+            return static_cast<q31_t>(Math::Minimum(Math::Maximum(shifted, StateType{ std::numeric_limits<q31_t>::min() }), StateType{ std::numeric_limits<q31_t>::max() }));
+        }
+        // State lives in registers for the whole block and is written back once
+        ALWAYS_INLINE
+        static void ProcessStage(Biquad const & c, StateType & state1, StateType & state2, q31_t * first, q31_t * const last) noexcept
+        {
+            StateType s1{ state1 };
+            StateType s2{ state2 };
+
+            for (; first != last; ++first)
+            {
+                StateType const x{ *first };
+                q31_t const y{ Saturate(s1 + (c.B0 * x)) };
+
+                s1 = s2 + (c.B1 * x) + (c.NegA1 * StateType{ y });
+                s2 = (c.B2 * x) + (c.NegA2 * StateType{ y });
+
+                *first = y;
+            }
+
+            state1 = s1;
+            state2 = s2;
+        }
+
+    private:
+        Coefficients m_coefficients{};
+        std::array<std::array<StateType, tChannels>, tStages> m_s1{};
+        std::array<std::array<StateType, tChannels>, tStages> m_s2{};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/math.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Common::DSP
+{
+    // Hogenauer decimator: tOrder integrators at the input rate, decimate by tRatio, tOrder combs at the output rate.
+    // Registers are unsigned 32 bit and wrap on purpose, the comb differences come out exact as long as the
+    // full gain of tRatio^tOrder fits, which the bit growth assert below guarantees for tInputBits wide signed input.
+    template <unsigned tOrder, size_t tRatio, size_t tChannels = 1u, unsigned tInputBits = 16u>
+    class CICDecimator
+    {
+    public:
+        static constexpr unsigned Order = tOrder;
+        static constexpr size_t Ratio = tRatio;
+        static constexpr size_t Channels = tChannels;
+        static constexpr unsigned GainBits = tOrder * Math::Log2(tRatio);
+        static constexpr unsigned OutputBits = tInputBits + GainBits;
+
+        static_assert(tOrder > 0u, "A CIC needs at least one stage.");
+        static_assert(Math::IsPowerOfTwo(tRatio) && (tRatio > 1u), "Decimation ratio must be a power of two so the gain is a shift.");
+        static_assert(OutputBits <= 32u, "Bit growth of this order and ratio does not fit the 32 bit registers.");
+
+        constexpr CICDecimator() noexcept = default;
+
+        constexpr void Reset() noexcept
+        {
+            for (auto & stage : m_integrators) { stage.fill(0u); }
+            for (auto & stage : m_combs) { stage.fill(0u); }
+            m_phase.fill(0u);
+        }
+        // Decimates one channel's block in place, the outputs are packed at the front of the block and
+        // the decimation phase carries over between blocks. Returns the number of outputs produced.
+        [[nodiscard]]
+        size_t Process(size_t const channel, Containers::Span<int32_t> block) noexcept
+        {
+            std::array<uint32_t, tOrder> integrators{ m_integrators[channel] };
+            size_t phase{ m_phase[channel] };
+            int32_t * output{ block.begin() };
+
+            for (int32_t const sample : block)
+            {
+                uint32_t acc{ static_cast<uint32_t>(sample) };
+                for (auto & integrator : integrators)
+                {
+                    integrator += acc;
+                    acc = integrator;
+                }
+
+                if (++phase == tRatio)
+                {
+                    phase = 0u;
+                    for (auto & comb : m_combs[channel])
+                    {
+                        uint32_t const delayed{ comb };
+                        comb = acc;
+                        acc -= delayed;
+                    }
+                    *output++ = static_cast<int32_t>(acc);
+                }
+            }
+
+            m_integrators[channel] = integrators;
+            m_phase[channel] = phase;
+
+            return static_cast<size_t>(output - block.begin());
+        }
+
+    private:
+        std::array<std::array<uint32_t, tOrder>, tChannels> m_integrators{};
+        std::array<std::array<uint32_t, tOrder>, tChannels> m_combs{};
+        std::array<size_t, tChannels> m_phase{};
+    };
+
+    namespace Design
+    {
+        // Three tap {a, 1 - 2a, a} droop compensator run at the CIC output rate, unity at DC and matched to the
+        // inverse CIC response at 'match' times the output rate. Coefficients carry tFracBits fractional bits.
+        template <unsigned tOrder, size_t tRatio, unsigned tFracBits = 15u>
+        consteval std::array<int32_t, 3u> CICCompensator(double const match = 0.25) noexcept
+        {
+            double const ratio{ static_cast<double>(tRatio) };
+            double const stage{ Math::Sine(Math::Pi * match) / (ratio * Math::Sine(Math::Pi * match / ratio)) };
+
+            double droop{ 1.0 };
+            for (unsigned i = 0; i < tOrder; ++i) { droop *= stage; }
+
+            double const a{ (1.0 - (1.0 / droop)) / (2.0 * (1.0 - Math::Cosine(2.0 * Math::Pi * match))) };
+            double const scale{ static_cast<double>(1u << tFracBits) };
+
+            auto const quantise = [scale](double const value) { return static_cast<int32_t>((value * scale) + ((value < 0.0) ? -0.5 : 0.5)); };
+
+            int32_t const outer{ quantise(a) };
+            return { outer, static_cast<int32_t>((1 << tFracBits) - (2 * outer)), outer };
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/math.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace Common::DSP
+{
+    // Short direct form FIR shared by tChannels independent signals. Coefficients carry tFracBits fractional bits
+    // and every tap is a 32x32->64 multiply-accumulate, so full 32 bit samples can pass through without pre-scaling.
+    template <size_t tTaps, size_t tChannels = 1u, unsigned tFracBits = 15u>
+    class FIR
+    {
+    public:
+        using Coefficients = std::array<int32_t, tTaps>;
+        using AccumType = int64_t;
+
+        static constexpr size_t Taps = tTaps;
+        static constexpr size_t Channels = tChannels;
+        static constexpr unsigned FracBits = tFracBits;
+
+        static_assert(tTaps > 0u, "A FIR needs at least one tap.");
+
+        constexpr FIR() noexcept = default;
+        constexpr explicit FIR(Coefficients const & coefficients) noexcept
+            : m_coefficients{ coefficients }
+        {}
+
+        constexpr void Reset() noexcept
+        {
+            for (auto & history : m_history) { history.fill(0); }
+        }
+        // Filters one channel's block in place
+        void Process(size_t const channel, Containers::Span<int32_t> block) noexcept
+        {
+            auto & history{ m_history[channel] };
+
+            for (int32_t & sample : block)
+            {
+                for (size_t k = (tTaps - 1u); k > 0u; --k) { history[k] = history[k - 1u]; }
+                history[0] = sample;
+
+                AccumType acc{ AccumType{ 1 } << (tFracBits - 1u) }; // Round to nearest
+                for (size_t k = 0; k < tTaps; ++k)
+                {
+                    acc += AccumType{ m_coefficients[k] } * history[k];
+                }
+                sample = Saturate(acc >> tFracBits);
+            }
+        }
+
+    private:
+        ALWAYS_INLINE
+        static int32_t Saturate(AccumType const input) noexcept
+        {
+            return static_cast<int32_t>(Math::Minimum(Math::Maximum(input, AccumType{ std::numeric_limits<int32_t>::min() }), AccumType{ std::numeric_limits<int32_t>::max() }));
+        }
+
+    private:
+        Coefficients m_coefficients{};
+        std::array<std::array<int32_t, tTaps>, tChannels> m_history{};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/math.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace Common::DSP
+{
+    // Window of the last tWindow samples where the front is always the extreme value. Every sample is pushed and
+    // popped at most once, so the cost is amortised O(1) and the storage is fixed at tWindow entries.
+    template <size_t tWindow, typename tKeep>
+    class MonotonicQueue
+    {
+    public:
+        static_assert(Math::IsPowerOfTwo(tWindow), "Window must be a power of two.");
+
+        constexpr void Clear() noexcept
+        {
+            m_head = 0u;
+            m_tail = 0u;
+        }
+        ALWAYS_INLINE
+        void Push(uint32_t const index, int32_t const value) noexcept
+        {
+            // At most one entry ages out per sample. It has to go before the store, a full queue would otherwise
+            // write the new sample over it.
+            if ((m_tail != m_head) && ((index - m_indices[m_head & Mask]) >= tWindow)) { ++m_head; }
+
+            // Drop everything at the back the new value dominates
+            while ((m_tail != m_head) && !tKeep{}(m_values[(m_tail - 1u) & Mask], value)) { --m_tail; }
+
+            m_values[m_tail & Mask] = value;
+            m_indices[m_tail & Mask] = index;
+            ++m_tail;
+        }
+        [[nodiscard]]
+        int32_t Front() const noexcept
+        {
+            return m_values[m_head & Mask];
+        }
+
+    private:
+        static constexpr uint32_t Mask = tWindow - 1u;
+
+        std::array<int32_t, tWindow> m_values{};
+        std::array<uint32_t, tWindow> m_indices{};
+        uint32_t m_head{ 0 };
+        uint32_t m_tail{ 0 };
+    };
+
+    template <size_t tWindow>
+    class SlidingExtrema
+    {
+    public:
+        constexpr void Reset() noexcept
+        {
+            m_minimum.Clear();
+            m_maximum.Clear();
+            m_index = 0u;
+        }
+        ALWAYS_INLINE
+        void Push(int32_t const value) noexcept
+        {
+            m_minimum.Push(m_index, value);
+            m_maximum.Push(m_index, value);
+            ++m_index;
+        }
+        [[nodiscard]]
+        int32_t Minimum() const noexcept
+        {
+            return m_minimum.Front();
+        }
+        [[nodiscard]]
+        int32_t Maximum() const noexcept
+        {
+            return m_maximum.Front();
+        }
+
+    private:
+        MonotonicQueue<tWindow, std::less<int32_t>> m_minimum{};
+        MonotonicQueue<tWindow, std::greater<int32_t>> m_maximum{};
+        uint32_t m_index{ 0 };
+    };
+
+    // Welford running mean and variance. The mean is kept with tFracBits fractional bits so the per-sample update is a
+    // single 32 bit divide, M2 is kept in whole units squared. Once tMaxCount samples are in, count and M2 are halved,
+    // the estimate then fades old samples out instead of overflowing. Inputs must stay below 2^(30 - tFracBits).
+    template <unsigned tFracBits = 6u, uint32_t tMaxCount = 0x10000u>
+    class Welford
+    {
+    public:
+        static_assert(Math::IsPowerOfTwo(tMaxCount), "Count limit must be a power of two.");
+
+        constexpr void Reset() noexcept
+        {
+            m_count = 0u;
+            m_mean = 0;
+            m_m2 = 0;
+        }
+        ALWAYS_INLINE
+        void Push(int32_t const value) noexcept
+        {
+            if (m_count == tMaxCount)
+            {
+                m_count >>= 1u;
+                m_m2 >>= 1u;
+            }
+            ++m_count;
+
+            int32_t const scaled{ value * (int32_t{ 1 } << tFracBits) };
+            int32_t const delta{ scaled - m_mean };
+            m_mean += delta / static_cast<int32_t>(m_count);
+            m_m2 += (int64_t{ delta } * (scaled - m_mean)) >> (2u * tFracBits);
+        }
+        [[nodiscard]]
+        uint32_t Count() const noexcept
+        {
+            return m_count;
+        }
+        [[nodiscard]]
+        int32_t Mean() const noexcept
+        {
+            return (m_mean >> tFracBits);
+        }
+        // Sample variance in units squared
+        [[nodiscard]]
+        int64_t Variance() const noexcept
+        {
+            return (m_count > 1u) ? (m_m2 / static_cast<int64_t>(m_count - 1u)) : 0;
+        }
+
+    private:
+        uint32_t m_count{ 0 };
+        int32_t m_mean{ 0 };
+        int64_t m_m2{ 0 };
+    };
+
+    // Root of the mean square over the last tWindow samples, the running sum is updated by the entering and leaving
+    // sample so a push is two multiplies. The root itself is only taken when the value is read.
+    template <size_t tWindow>
+    class SlidingRMS
+    {
+    public:
+        static_assert(Math::IsPowerOfTwo(tWindow), "Window must be a power of two.");
+
+        constexpr void Reset() noexcept
+        {
+            m_history.fill(0);
+            m_sum = 0u;
+            m_index = 0u;
+        }
+        ALWAYS_INLINE
+        void Push(int32_t const value) noexcept
+        {
+            int32_t const leaving{ m_history[m_index] };
+
+            m_history[m_index] = value;
+            m_index = (m_index + 1u) & Mask;
+            m_sum += static_cast<uint64_t>(int64_t{ value } * value);
+            m_sum -= static_cast<uint64_t>(int64_t{ leaving } * leaving);
+        }
+        [[nodiscard]]
+        uint32_t RMS() const noexcept
+        {
+            return Math::IntegerSqrt(m_sum >> Math::Log2(tWindow));
+        }
+
+    private:
+        static constexpr size_t Mask = tWindow - 1u;
+
+        std::array<int32_t, tWindow> m_history{};
+        uint64_t m_sum{ 0 };
+        size_t m_index{ 0 };
+    };
+}
\ No newline at end of file
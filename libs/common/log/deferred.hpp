@@ -0,0 +1,164 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/atomic.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#define DEFERRED_LOG_STRINGIFY_(x) #x
+#define DEFERRED_LOG_STRINGIFY(x) DEFERRED_LOG_STRINGIFY_(x)
+
+// Address of 'format' in .log_strings, a section the linker keeps in the ELF at address 0 but never loads, so the
+// string costs no flash and its offset doubles as its ID. One section per string keeps the flags of strings from
+// inline and non-inline functions apart.
+#define DEFERRED_LOG_FORMAT(format)                                                                                     \
+    ([]() noexcept -> uint32_t                                                                                          \
+    {                                                                                                                   \
+        __attribute__((section(".log_strings." DEFERRED_LOG_STRINGIFY(__COUNTER__)), used))                            \
+        static char const s_format[] = format;                                                                          \
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(s_format));                                           \
+    }())
+
+namespace Common::Log
+{
+    // Lock-free multi producer, single consumer record ring. A producer reserves its words through Atomic, fills
+    // them and sets the header last, the consumer stops at the first header still being written so records leave in
+    // the order they were reserved. Arguments are stored raw, one word each: 64 bit integers take two, floating point
+    // is narrowed to float. The host finds the types in the format string.
+    //
+    // Record: | Committed flag, argument word count | format ID | timestamp | arguments |
+    template <size_t tWords>
+    class Deferred
+    {
+    public:
+        static constexpr uint32_t Committed = 0x8000'0000u;
+        static constexpr size_t HeaderWords = 3u;
+        static constexpr size_t MaxArguments = 16u;
+
+        static_assert((tWords & (tWords - 1u)) == 0u, "Ring size must be a power of two.");
+        static_assert(tWords >= (HeaderWords + MaxArguments), "Ring must hold the largest record.");
+
+        // Any context, false and counted as dropped when the ring is full
+        template <typename... tArgs>
+        ALWAYS_INLINE
+        bool Write(uint32_t const format, uint32_t const time, tArgs const ... args) noexcept
+        {
+            constexpr uint32_t arguments{ (0u + ... + Words<tArgs>()) };
+            constexpr uint32_t size{ HeaderWords + arguments };
+            static_assert(arguments <= MaxArguments, "Too many arguments for one record.");
+
+            uint32_t start;
+            bool const reserved{ Atomic::ModifyIf(m_head, [&](uint32_t const head, uint32_t & next) noexcept
+            {
+                start = head;
+                next = head + size;
+                return ((next - m_tail) <= tWords);
+            }) };
+            if (!reserved)
+            {
+                Atomic::Add(m_dropped, 1);
+                return false;
+            }
+
+            uint32_t index{ start + 1u };
+            Store(index, format);
+            Store(index, time);
+            ( Store(index, args), ... );
+
+            __DMB();
+            m_words[start & Mask] = Committed | arguments;
+            return true;
+        }
+
+        // Single consumer, copies whole records that fit 'out' without the commit flag and frees their words.
+        // Returns the number of words copied.
+        size_t Read(Containers::Span<uint32_t> out) noexcept
+        {
+            size_t count{ 0 };
+            uint32_t tail{ m_tail };
+
+            while (tail != m_head)
+            {
+                uint32_t const header{ m_words[tail & Mask] };
+                if ((header & Committed) == 0u) { break; } // Reserved, still being filled
+
+                size_t const size{ HeaderWords + (header & ~Committed) };
+                if ((count + size) > out.size()) { break; }
+
+                __DMB();
+                for (size_t i = 0; i < size; ++i)
+                {
+                    out[count + i] = m_words[(tail + i) & Mask];
+                    m_words[(tail + i) & Mask] = 0u; // Only a zero header reads as unfinished
+                }
+                out[count] = header & ~Committed;
+                count += size;
+                tail += size;
+            }
+
+            __DMB();
+            m_tail = tail;
+            return count;
+        }
+        [[nodiscard]]
+        bool Empty() const noexcept
+        {
+            return (m_tail == m_head);
+        }
+        [[nodiscard]]
+        uint32_t Dropped() const noexcept
+        {
+            return m_dropped;
+        }
+
+    private:
+        static constexpr uint32_t Mask = tWords - 1u;
+
+        template <typename T>
+        static constexpr uint32_t Words() noexcept
+        {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>, "Only numbers, enums and pointers can be logged.");
+
+            if constexpr (std::is_floating_point_v<T>) { return 1u; }
+            else { return (sizeof(T) > sizeof(uint32_t)) ? 2u : 1u; }
+        }
+        template <typename T>
+        ALWAYS_INLINE
+        void Store(uint32_t & index, T const value) noexcept
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                float const narrow{ static_cast<float>(value) };
+                uint32_t word;
+                std::memcpy(&word, &narrow, sizeof(word));
+                Put(index, word);
+            }
+            else if constexpr (std::is_pointer_v<T>) { Put(index, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value))); }
+            else if constexpr (sizeof(T) > sizeof(uint32_t))
+            {
+                uint64_t const wide{ static_cast<uint64_t>(value) };
+                Put(index, static_cast<uint32_t>(wide));
+                Put(index, static_cast<uint32_t>(wide >> 32u));
+            }
+            else { Put(index, static_cast<uint32_t>(value)); }
+        }
+        ALWAYS_INLINE
+        void Put(uint32_t & index, uint32_t const word) noexcept
+        {
+            m_words[index & Mask] = word;
+            index = index + 1u;
+        }
+
+    private:
+        std::array<uint32_t volatile, tWords> m_words{};
+        uint32_t volatile m_head{ 0 };
+        uint32_t volatile m_tail{ 0 };
+        uint32_t volatile m_dropped{ 0 };
+    };
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace Common::Math
 {
     template <typename T>
@@ -19,4 +21,61 @@ namespace Common::Math
     {
         return ((val >= min) && (val <= max));
     }
+
+    template <typename T>
+    constexpr auto IsPowerOfTwo(T const & val) noexcept -> bool
+    {
+        return ((val != 0) && ((val & (val - 1)) == 0));
+    }
+
+    template <typename T>
+    constexpr auto Log2(T val) noexcept -> unsigned
+    {
+        unsigned result{ 0 };
+        while (val >>= 1) { ++result; }
+        return result;
+    }
+
+    // Bitwise square root, floor(sqrt(val)) without division
+    constexpr auto IntegerSqrt(uint64_t val) noexcept -> uint32_t
+    {
+        uint64_t result{ 0 };
+        uint64_t bit{ uint64_t{ 1 } << 62u };
+
+        while (bit > val) { bit >>= 2u; }
+        while (bit != 0u)
+        {
+            if (val >= (result + bit))
+            {
+                val -= (result + bit);
+                result = (result >> 1u) + bit;
+            }
+            else { result >>= 1u; }
+            bit >>= 2u;
+        }
+        return static_cast<uint32_t>(result);
+    }
+
+    constexpr double Pi = 3.14159265358979323846;
+
+    // Compile-time only helpers for deriving coefficients, never call these on target
+    consteval double Sine(double x) noexcept
+    {
+        while (x > Pi) { x -= 2.0 * Pi; }
+        while (x < -Pi) { x += 2.0 * Pi; }
+
+        double term{ x };
+        double sum{ x };
+        for (int n = 1; n < 16; ++n)
+        {
+            term *= -(x * x) / static_cast<double>((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    consteval double Cosine(double const x) noexcept
+    {
+        return Sine(x + (Pi / 2.0));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "common/atomic.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace Common
+{
+    struct PoolStatistics
+    {
+        uint32_t InUse{ 0 };
+        uint32_t HighWater{ 0 };    // Most blocks ever taken at once
+        uint32_t Failures{ 0 };     // Allocations refused because every block was taken
+    };
+
+    // Fixed block allocator. Free blocks form a stack of indices whose top is swapped through Atomic, so allocating
+    // and freeing are O(1) from any context. An interrupted update simply retries, which also rules out ABA on the
+    // top index.
+    template <typename T, size_t N>
+    class Pool
+    {
+    public:
+        static_assert((N != 0u) && (N < 0xFFFF'FFFFu), "Pool size out of range.");
+
+        // Owns one block and returns it to the pool when it goes out of scope. Empty when the allocation failed.
+        class Handle
+        {
+        public:
+            constexpr Handle() noexcept = default;
+            Handle(Handle const &) = delete;
+            Handle & operator = (Handle const &) = delete;
+
+            Handle(Handle && other) noexcept
+                : m_pool{ std::exchange(other.m_pool, nullptr) }
+                , m_block{ std::exchange(other.m_block, nullptr) }
+            {}
+            Handle & operator = (Handle && other) noexcept
+            {
+                if (this != &other)
+                {
+                    Release();
+                    m_pool = std::exchange(other.m_pool, nullptr);
+                    m_block = std::exchange(other.m_block, nullptr);
+                }
+                return *this;
+            }
+            ~Handle() noexcept
+            {
+                Release();
+            }
+
+            void Release() noexcept
+            {
+                if (m_block != nullptr) { m_pool->Free(m_block); }
+                m_pool = nullptr;
+                m_block = nullptr;
+            }
+            [[nodiscard]]
+            T * Get() const noexcept
+            {
+                return m_block;
+            }
+            T & operator * () const noexcept
+            {
+                return *m_block;
+            }
+            T * operator -> () const noexcept
+            {
+                return m_block;
+            }
+            explicit operator bool () const noexcept
+            {
+                return (m_block != nullptr);
+            }
+
+        private:
+            friend class Pool;
+
+            Handle(Pool * const pool, T * const block) noexcept
+                : m_pool{ pool }
+                , m_block{ block }
+            {}
+
+        private:
+            Pool * m_pool{ nullptr };
+            T * m_block{ nullptr };
+        };
+
+        Pool() noexcept
+        {
+            for (uint32_t i = 0; i < N; ++i) { m_next[i] = i + 1u; }
+        }
+        Pool(Pool const &) = delete;
+        Pool & operator = (Pool const &) = delete;
+
+        // Any context, 'args' construct the block
+        template <typename... tArgs>
+        [[nodiscard]]
+        Handle Allocate(tArgs && ... args) noexcept
+        {
+            T * const block{ Acquire(std::forward<tArgs>(args)...) };
+            return (block != nullptr) ? Handle{ this, block } : Handle{};
+        }
+        // Raw interface for blocks whose lifetime spans contexts, nullptr when exhausted
+        template <typename... tArgs>
+        [[nodiscard]]
+        T * Acquire(tArgs && ... args) noexcept
+        {
+            uint32_t index;
+            bool const taken{ Atomic::ModifyIf(m_free, [&](uint32_t const top, uint32_t & next) noexcept
+            {
+                index = top;
+                if (top == Empty) { return false; }
+                next = m_next[top];
+                return true;
+            }) };
+            if (!taken)
+            {
+                Atomic::Add(m_failures, 1);
+                return nullptr;
+            }
+
+            Atomic::Max(m_highWater, Atomic::Add(m_inUse, 1));
+
+            void * const storage{ &m_blocks[index] };
+            if constexpr (sizeof...(tArgs) == 0u) { return ::new (storage) T; } // Plain buffers are not cleared
+            else { return ::new (storage) T{ std::forward<tArgs>(args)... }; }
+        }
+        void Free(T * const block) noexcept
+        {
+            uint32_t const index{ static_cast<uint32_t>(reinterpret_cast<Block *>(block) - m_blocks.data()) };
+            block->~T();
+
+            Atomic::Modify(m_free, [&](uint32_t const top) noexcept
+            {
+                m_next[index] = top;
+                return index;
+            });
+
+            Atomic::Add(m_inUse, -1);
+        }
+
+        [[nodiscard]]
+        PoolStatistics Statistics() const noexcept
+        {
+            return PoolStatistics{ m_inUse, m_highWater, m_failures };
+        }
+        [[nodiscard]]
+        static constexpr size_t Capacity() noexcept
+        {
+            return N;
+        }
+
+    private:
+        struct alignas(T) Block
+        {
+            uint8_t Storage[sizeof(T)];
+        };
+
+        static constexpr uint32_t Empty = N;
+
+    private:
+        std::array<Block, N> m_blocks;
+        std::array<uint32_t volatile, N> m_next{};
+        uint32_t volatile m_free{ 0 };
+        uint32_t volatile m_inUse{ 0 };
+        uint32_t volatile m_highWater{ 0 };
+        uint32_t volatile m_failures{ 0 };
+    };
+}
\ No newline at end of file
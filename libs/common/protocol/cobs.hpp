@@ -0,0 +1,84 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/containers/span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace Common::Protocol
+{
+    // Consistent overhead byte stuffing: no zero byte survives encoding, so a single 0x00 delimits frames and a
+    // receiver resynchronises on the next delimiter after any corruption. Worst case is one extra byte per 254.
+    namespace COBS
+    {
+        static constexpr uint8_t Delimiter = 0x00u;
+
+        // Stuffed size of 'size' input bytes, without the delimiter
+        constexpr size_t MaxEncodedSize(size_t const size) noexcept
+        {
+            return (size + (size / 254u) + 1u);
+        }
+
+        // Stuffs one byte at a time straight into 'output', so the caller never needs an unstuffed copy of the frame
+        class Encoder
+        {
+        public:
+            explicit Encoder(Containers::Span<uint8_t> output) noexcept
+                : m_output{ output }
+            {}
+
+            ALWAYS_INLINE
+            void Put(uint8_t const byte) noexcept
+            {
+                if (byte == Delimiter)
+                {
+                    Close();
+                    return;
+                }
+
+                m_output[m_position++] = byte;
+                if ((m_position - m_code) == 0xFFu) { Close(); }
+            }
+            // Closes the last block and appends the delimiter, returns the finished frame
+            Containers::Span<uint8_t> Finish() noexcept
+            {
+                m_output[m_code] = static_cast<uint8_t>(m_position - m_code);
+                m_output[m_position++] = Delimiter;
+                return m_output.first(m_position);
+            }
+
+        private:
+            ALWAYS_INLINE
+            void Close() noexcept
+            {
+                m_output[m_code] = static_cast<uint8_t>(m_position - m_code);
+                m_code = m_position++;
+            }
+
+        private:
+            Containers::Span<uint8_t> m_output;
+            size_t m_code{ 0 };
+            size_t m_position{ 1 };
+        };
+
+        // Unstuffs in place, 'input' excludes the delimiter. Returns the decoded size or nothing on a malformed frame.
+        inline std::optional<size_t> Decode(Containers::Span<uint8_t> input) noexcept
+        {
+            size_t read{ 0 };
+            size_t write{ 0 };
+
+            while (read < input.size())
+            {
+                uint8_t const code{ input[read++] };
+                if ((code == Delimiter) || ((read + code - 1u) > input.size())) { return {}; }
+
+                for (uint8_t i = 1u; i < code; ++i) { input[write++] = input[read++]; }
+                if ((code != 0xFFu) && (read < input.size())) { input[write++] = Delimiter; }
+            }
+            return write;
+        }
+    }
+}
\ No newline at end of file
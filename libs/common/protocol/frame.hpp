@@ -0,0 +1,102 @@
+#pragma once
+
+#include "macros.h"
+
+#include "common/protocol/cobs.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Common::Protocol
+{
+    // Frame before stuffing: | type | sequence | payload ... | CRC32 little endian |
+    // On the wire the stuffed frame sits between two delimiters, so text or noise ahead of it never corrupts it.
+    // The CRC covers type, sequence and payload taken as little endian words, the last one zero padded, which is
+    // exactly what a word wide CRC unit sees when the bytes are fed from memory.
+    struct FrameHeader
+    {
+        uint8_t Type;
+        uint8_t Sequence;
+    };
+
+    // tChecksum provides static Reset(), Feed(uint32_t word) and Value()
+    template <typename tChecksum, size_t tMaxPayload>
+    class FrameWriter
+    {
+    public:
+        static constexpr size_t HeaderSize = sizeof(FrameHeader);
+        static constexpr size_t ChecksumSize = sizeof(uint32_t);
+        static constexpr size_t MaxPayload = tMaxPayload;
+        static constexpr size_t MaxFrame = COBS::MaxEncodedSize(HeaderSize + tMaxPayload + ChecksumSize) + 2u;
+
+        using Buffer = std::array<uint8_t, MaxFrame>;
+        using Bytes = Containers::Span<uint8_t const>;
+
+        FrameWriter(Buffer & buffer, FrameHeader const header) noexcept
+            : m_buffer{ buffer.data() }
+            , m_encoder{ Containers::Span<uint8_t>{ buffer.data() + 1, buffer.size() - 1u } }
+        {
+            buffer[0] = COBS::Delimiter;
+            tChecksum::Reset();
+            Put(header.Type);
+            Put(header.Sequence);
+        }
+
+        // Returns false and writes nothing once the payload would exceed tMaxPayload
+        bool Append(Bytes bytes) noexcept
+        {
+            if ((m_payload + bytes.size()) > tMaxPayload) { return false; }
+
+            m_payload += bytes.size();
+            for (size_t i = 0; i < bytes.size(); ++i) { Put(bytes[i]); }
+            return true;
+        }
+        template <typename T>
+        bool Append(T const & value) noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be appended.");
+            return Append(Bytes{ reinterpret_cast<uint8_t const *>(&value), sizeof(T) });
+        }
+        [[nodiscard]]
+        size_t PayloadSize() const noexcept
+        {
+            return m_payload;
+        }
+        // Stuffed frame including the delimiter, ready to hand to the transmitter as is
+        Containers::Span<uint8_t> Finish() noexcept
+        {
+            if (m_fill != 0u) { tChecksum::Feed(m_word); }
+
+            uint32_t const crc{ tChecksum::Value() };
+            for (unsigned shift = 0; shift < 32u; shift += 8u)
+            {
+                m_encoder.Put(static_cast<uint8_t>(crc >> shift));
+            }
+            return Containers::Span<uint8_t>{ m_buffer, m_encoder.Finish().size() + 1u };
+        }
+
+    private:
+        ALWAYS_INLINE
+        void Put(uint8_t const byte) noexcept
+        {
+            m_word |= (uint32_t{ byte } << (8u * m_fill));
+            if (++m_fill == 4u)
+            {
+                tChecksum::Feed(m_word);
+                m_word = 0u;
+                m_fill = 0u;
+            }
+            m_encoder.Put(byte);
+        }
+
+    private:
+        uint8_t * m_buffer;
+        COBS::Encoder m_encoder;
+        uint32_t m_word{ 0 };
+        unsigned m_fill{ 0 };
+        size_t m_payload{ 0 };
+    };
+}
\ No newline at end of file
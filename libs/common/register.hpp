@@ -3,10 +3,49 @@
 #include "macros.h"
 
 #include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <tuple>
+#include <utility>
 
 namespace Common 
 {
+    // Value of a field that has not been written yet, already shifted into place. Fields of one register combine
+    // with '|', WriteFields() stores them.
+    template <typename T, uint32_t tAddress, T tBitmask>
+    struct FieldValue
+    {
+        using ValueType = T;
+
+        static constexpr uint32_t Address = tAddress;
+        static constexpr T Mask = tBitmask;
+
+        T Bits;
+
+        template <T tOtherMask>
+        ALWAYS_INLINE
+        constexpr FieldValue<T, tAddress, static_cast<T>(tBitmask | tOtherMask)> operator | (FieldValue<T, tAddress, tOtherMask> const other) const noexcept
+        {
+            return { static_cast<T>((Bits & static_cast<T>(~tOtherMask)) | other.Bits) };
+        }
+    };
+
+    // Cortex-M3 bit-band: each bit in the first MB of SRAM and of the peripheral space has its own word in an alias
+    // region, and a store there changes that bit alone in one bus transaction
+    namespace BitBand
+    {
+        constexpr bool Covers(uint32_t const address) noexcept
+        {
+            return ((address - 0x2000'0000u) < 0x10'0000u) || ((address - 0x4000'0000u) < 0x10'0000u);
+        }
+        constexpr uint32_t Alias(uint32_t const address, uint32_t const bit) noexcept
+        {
+            return (address & 0xF000'0000u) + 0x0200'0000u + ((address & 0x000F'FFFFu) << 5u) + (bit << 2u);
+        }
+    }
+
+    // Single bit fields inside a bit-band region are written through their alias word, so Set, Clear and Write are
+    // one store that cannot tear other bits of the register changed by an interrupt in between
     template <typename T, uint32_t tAddress, T tBitmask>
     class Bitfield
     {
@@ -19,12 +58,14 @@ namespace Common
         ALWAYS_INLINE 
         void Clear() noexcept
         {
-            (*s_Address) &= s_NMask;
+            if constexpr (s_BitBand) { (*s_Alias) = 0u; }
+            else { (*s_Address) &= s_NMask; }
         }
         ALWAYS_INLINE 
         void Set() noexcept
         {
-            (*s_Address) = (*s_Address & s_NMask) | s_Mask;
+            if constexpr (s_BitBand) { (*s_Alias) = 1u; }
+            else { (*s_Address) = (*s_Address & s_NMask) | s_Mask; }
         }
         ALWAYS_INLINE 
         void Toggle() noexcept
@@ -34,12 +75,14 @@ namespace Common
         ALWAYS_INLINE 
         void Write(ValueType const input) noexcept
         {
-            (*s_Address) = (*s_Address & s_NMask) | apply_mask(input);
+            if constexpr (s_BitBand) { (*s_Alias) = static_cast<uint32_t>(input & 1u); }
+            else { (*s_Address) = (*s_Address & s_NMask) | apply_mask(input); }
         }
         ALWAYS_INLINE 
         ValueType Read() const noexcept
         {
-            return (((*s_Address) & s_Mask) >> s_Position);
+            if constexpr (s_BitBand) { return static_cast<ValueType>(*s_Alias); }
+            else { return (((*s_Address) & s_Mask) >> s_Position); }
         }
         ALWAYS_INLINE
         operator ValueType() const noexcept
@@ -55,27 +98,43 @@ namespace Common
         ALWAYS_INLINE 
         Bitfield & operator |= (ValueType const other) noexcept
         {
-            (*s_Address) |= apply_mask(other);
+            if constexpr (s_BitBand)
+            {
+                if ((other & 1u) != 0u) { Set(); }
+            }
+            else { (*s_Address) |= apply_mask(other); }
             return *this;
         }
         ALWAYS_INLINE 
         Bitfield & operator &= (ValueType const other) noexcept
         {
-            (*s_Address) &= (apply_mask(other) | s_NMask);
+            if constexpr (s_BitBand)
+            {
+                if ((other & 1u) == 0u) { Clear(); }
+            }
+            else { (*s_Address) &= (apply_mask(other) | s_NMask); }
             return *this;
         }
+        // Deferred write of 'input', see WriteFields()
+        ALWAYS_INLINE
+        static constexpr FieldValue<T, tAddress, tBitmask> Value(ValueType const input) noexcept
+        {
+            return { static_cast<ValueType>(apply_mask(input)) };
+        }
 
     private:
-        static auto apply_mask(ValueType const input) noexcept
+        static constexpr auto apply_mask(ValueType const input) noexcept
         {
             return ((input << s_Position) & s_Mask);
         }
 
         static constexpr ValueType s_Mask{ tBitmask };
-        static constexpr ValueType s_NMask{ (~s_Mask) };
+        static constexpr ValueType s_NMask{ static_cast<ValueType>(~s_Mask) };
         static constexpr ValueType s_Position{ std::countr_zero(s_Mask) };
+        static constexpr bool s_BitBand{ (std::popcount(s_Mask) == 1) && BitBand::Covers(tAddress) };
 
         inline static Pointer s_Address{ reinterpret_cast<Pointer>(tAddress) };
+        inline static uint32_t volatile * const s_Alias{ reinterpret_cast<uint32_t volatile *>(BitBand::Alias(tAddress, s_Position)) };
     };
 
     template <typename T, uint32_t tAddress>
@@ -316,6 +375,60 @@ namespace Common
         inline static Pointer s_Address{ reinterpret_cast<Pointer>(tAddress) };
 
     };
+
+    namespace Detail
+    {
+        template <size_t tIndex, typename... tFields>
+        constexpr bool LeadsGroup() noexcept
+        {
+            constexpr uint32_t addresses[]{ tFields::Address... };
+            for (size_t i = 0; i < tIndex; ++i)
+            {
+                if (addresses[i] == addresses[tIndex]) { return false; }
+            }
+            return true;
+        }
+        template <size_t tIndex, typename... tFields>
+        ALWAYS_INLINE
+        void WriteGroup(tFields const... fields) noexcept
+        {
+            if constexpr (LeadsGroup<tIndex, tFields...>())
+            {
+                using Lead = std::tuple_element_t<tIndex, std::tuple<tFields...>>;
+                using T = typename Lead::ValueType;
+
+                constexpr uint32_t address{ Lead::Address };
+                constexpr T mask{ static_cast<T>((T{ 0 } | ... | ((tFields::Address == address) ? tFields::Mask : T{ 0 }))) };
+
+                T bits{ 0 };
+                ( ((tFields::Address == address) ? (bits = static_cast<T>((bits & static_cast<T>(~tFields::Mask)) | fields.Bits)) : bits), ... );
+
+                T volatile * const reg{ reinterpret_cast<T volatile *>(address) };
+                if constexpr (mask == static_cast<T>(~T{ 0 })) { *reg = bits; }
+                else if constexpr ((std::popcount(mask) == 1) && BitBand::Covers(address))
+                {
+                    *reinterpret_cast<uint32_t volatile *>(BitBand::Alias(address, std::countr_zero(mask))) = ((bits & mask) != 0u);
+                }
+                else { *reg = static_cast<T>((*reg & static_cast<T>(~mask)) | bits); }
+            }
+        }
+        template <size_t... tIndex, typename... tFields>
+        ALWAYS_INLINE
+        void WriteGroups(std::index_sequence<tIndex...>, tFields const... fields) noexcept
+        {
+            ( WriteGroup<tIndex>(fields...), ... );
+        }
+    }
+
+    // Writes fields built with Bitfield::Value() at one access per register: the masks of every field on a register
+    // are merged at compile time into a single read-modify-write, which becomes a plain store when they cover the
+    // whole register and a bit-band store when they reduce to one bit. A later field wins where masks overlap, registers are written in the order they first appear.
+    template <typename... tFields>
+    ALWAYS_INLINE
+    void WriteFields(tFields const... fields) noexcept
+    {
+        Detail::WriteGroups(std::index_sequence_for<tFields...>{}, fields...);
+    }
 }
 
 template <uint32_t RegAddress>
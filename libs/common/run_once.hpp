@@ -1,33 +1,30 @@
 #pragma once
 
-#include <cstddef>
+#include "common/atomic.hpp"
+
+#include <cstdint>
 
 namespace Common
 {
+    // T::Construct() runs for the first instance and T::Destruct() after the last one is gone. Both run with
+    // interrupts masked: an instance created in an interrupt that preempted the first one would otherwise find the
+    // count taken and carry on before Construct() had finished. They have to stay short, e.g. a clock enable bit.
     template <typename T>
     struct RunOnce
     {
     public:
         RunOnce() noexcept
         {
-            if (Construct()) { T::Construct(); }
+            CriticalSection const lock{};
+            if (++s_count == 1u) { T::Construct(); }
         }
         ~RunOnce() noexcept
         {
-            if (Destruct()) { T::Destruct(); }
+            CriticalSection const lock{};
+            if (--s_count == 0u) { T::Destruct(); }
         }
 
     private:
-        inline static size_t s_count = 0;
-
-        static bool Construct() noexcept
-        {
-            bool const retval = (s_count++ == 0);
-            return retval;
-        }
-        static bool Destruct() noexcept
-        {
-            return (--s_count == 0);
-        }
+        inline static uint32_t s_count = 0;
     };
 }
\ No newline at end of file
@@ -11,7 +11,10 @@ namespace Common
     class StaticLambda
     {
     public:
-        using buffer_t = uint8_t[sizeof(std::decay_t<T>)];
+        struct alignas(T) buffer_t
+        {
+            uint8_t Storage[sizeof(T)];
+        };
 
         StaticLambda() = default;
 
@@ -19,7 +22,7 @@ namespace Common
         {
             Construct(std::forward<T>(function));
         }
-        StaticLambda & operator = (T && function) const noexcept
+        StaticLambda & operator = (T && function) noexcept
         {
             Construct(std::forward<T>(function));
             return *this;
@@ -42,15 +45,14 @@ namespace Common
         {
             if (s_dataPtr)
             {
-                ((T*)s_data) -> ~T();
+                s_dataPtr -> ~T();
                 s_dataPtr = nullptr;
             }
         }
         static void Construct(T && function) noexcept
         {
             Destruct();
-            ::new(s_data) T{ std::move(function) };
-            s_dataPtr = (T*)&s_data[0];
+            s_dataPtr = ::new(&s_data) T{ std::move(function) };
         }
 
     public:
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "macros.h"
+
 #include "common/tools.hpp"
+#include "mcu/gpio.hpp"
+
 #include <cstddef>
 #include <cstdint>
 #include <limits>
@@ -59,7 +63,7 @@ namespace External::DAC80004
     {
         enum Command : uint8_t { SET, UPDATE, SET_LDAC, SET_UPDATE };
 
-        explicit OutputCommand(Channel channel, uint16_t value, Command cmd, bool read = false)
+        explicit OutputCommand(DAC80004::Channel channel, uint16_t value, Command cmd, bool read = false)
             : Value{ value }
             , Channel{ Common::Tools::EnumValue(channel) }
             , Command{ cmd }
@@ -73,7 +77,7 @@ namespace External::DAC80004
         uint32_t RW : 4;
     };
 
-    template <typename SPI_Module>
+    template <typename tSPI, typename tSyncPin>
     class Module
     {
     public:
@@ -102,7 +106,51 @@ namespace External::DAC80004
         template <Channel tChannel>
         static constexpr uint32_t SetOutputBuffer(uint16_t const value) noexcept
         {
-            return (CMD::Write << cmd_pos) | (Common::Tools::EnumValue(tChannel) << ch_pos) | (value << val_pos);
+            return Frame<tChannel>(CMD::Write, value);
+        }
+        template <Channel tChannel>
+        static constexpr uint32_t Frame(CMD const cmd, uint16_t const value) noexcept
+        {
+            return (uint32_t{ cmd } << cmd_pos) | (uint32_t{ Common::Tools::EnumValue(tChannel) } << ch_pos) | (uint32_t{ value } << val_pos);
+        }
+
+        // Write the input register and update the output in one frame
+        template <Channel tChannel>
+        ALWAYS_INLINE
+        static void SetOutput(uint16_t const value) noexcept
+        {
+            Transmit(Frame<tChannel>(CMD::Write_Update, value));
+        }
+        // Returns once the frame is under way, the data register is double buffered so the second word only waits for
+        // the first to reach the shift register. Complete() has to run from the SPI interrupt to release SYNC.
+        static void Transmit(uint32_t const frame) noexcept
+        {
+            SPI_DataType const data{ frame };
+
+            while (Busy());
+            s_remaining = 2u;
+
+            (void)spi_t::Registers::DR().Read();
+            tSyncPin::Write(MCU::IO::State::Low);
+            spi_t::Registers::CR2().RXNEIE() = true;
+            spi_t::Write(data.MSB);
+            spi_t::Write(data.LSB);
+        }
+        // RXNE is set after the last clock edge of each word, after the second the DAC has all 32 bits
+        static void Complete() noexcept
+        {
+            (void)spi_t::Registers::DR().Read();
+            if (s_remaining == 0u) { return; }
+
+            s_remaining = s_remaining - 1u;
+            if (s_remaining != 0u) { return; }
+
+            spi_t::Registers::CR2().RXNEIE() = false;
+            tSyncPin::Write(MCU::IO::State::High);
+        }
+        static bool Busy() noexcept
+        {
+            return (s_remaining != 0u);
         }
 
         static void insert_cmd(CMD const cmd, uint32_t& output) noexcept
@@ -123,7 +171,7 @@ namespace External::DAC80004
         static constexpr std::size_t reg_pos = 0u;
         static constexpr uint32_t reg_mask = (0xF << reg_pos);
 
-        using spi_t = SPI_Module;
+        using spi_t = typename tSPI::HAL;
 
         struct DAC_ValueType
         {
@@ -139,8 +187,8 @@ namespace External::DAC80004
 
             constexpr SPI_DataType() = default;
             explicit SPI_DataType(uint32_t input) :
-                LSB{ static_cast<uint16_t>((input & 0xFF)) },
-                MSB{ static_cast<uint16_t>(((input >> 16u) & 0xFF)) }
+                LSB{ static_cast<uint16_t>((input & 0xFFFF)) },
+                MSB{ static_cast<uint16_t>(((input >> 16u) & 0xFFFF)) }
             {}
             explicit SPI_DataType(uint16_t msb, uint16_t lsb) :
                 LSB{ lsb },
@@ -151,6 +199,10 @@ namespace External::DAC80004
         
 
     private:
+        // Idles high and is held low for each frame. A pin from the board map is already set up and ignores this.
+        tSyncPin const m_sync{ MCU::IO::State::High, MCU::IO::Output::PushPull, MCU::IO::OutputSpeed::_50MHz };
         float m_VoltageRef;
+
+        inline static uint8_t volatile s_remaining{ 0 };
     };
 }
\ No newline at end of file
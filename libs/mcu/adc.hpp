@@ -0,0 +1,192 @@
+#pragma once
+
+#include "macros.h"
+
+#include "rcc.hpp"
+#include "interrupt.hpp"
+#include "dma.hpp"
+#include "adc_registers.hpp"
+
+#include "common/delegate.hpp"
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace MCU::ADC
+{
+    enum class Peripheral : uint8_t
+    {
+        ADC_1 = 1u,
+        ADC_2
+    };
+
+    namespace {
+        template <Peripheral tPeriph>
+        constexpr auto ClockID() noexcept
+        {
+            if constexpr (tPeriph == Peripheral::ADC_1) { return CLK::ClockID::APB2_ADC1; }
+            if constexpr (tPeriph == Peripheral::ADC_2) { return CLK::ClockID::APB2_ADC2; }
+        }
+        constexpr uint32_t SampleHalfCycles(SampleTime const time) noexcept
+        {
+            switch (time)
+            {
+                case SampleTime::_1_5: return 3u;
+                case SampleTime::_7_5: return 15u;
+                case SampleTime::_13_5: return 27u;
+                case SampleTime::_28_5: return 57u;
+                case SampleTime::_41_5: return 83u;
+                case SampleTime::_55_5: return 111u;
+                case SampleTime::_71_5: return 143u;
+                default: return 479u;
+            }
+        }
+    }
+
+    // The regular sequence 'tInputs' is converted once per trigger edge. Results are left aligned, so a 12 bit
+    // conversion reads as a 16 bit code with the low four bits clear.
+    template
+    <
+        Peripheral tPeriph
+        , size_t tAdcClock
+        , size_t tTriggerRate
+        , Trigger tTrigger
+        , SampleTime tSampleTime
+        , size_t tBlockSize
+        , unsigned tPriority
+        , unsigned... tInputs
+    >
+    struct Properties
+    {
+        static constexpr auto s_Peripheral = tPeriph;
+        static constexpr auto s_AdcClockFreq = tAdcClock;
+        static constexpr auto s_TriggerRate = tTriggerRate;
+        static constexpr auto s_Trigger = tTrigger;
+        static constexpr auto s_SampleTime = tSampleTime;
+        static constexpr auto s_BlockSize = tBlockSize;
+        static constexpr auto s_Priority = tPriority;
+        static constexpr size_t s_InputCount = sizeof...(tInputs);
+
+        using Inputs = std::integer_sequence<unsigned, tInputs...>;
+
+        // Sample time plus 12.5 clocks of conversion per input, in half ADC clocks
+        static constexpr uint32_t s_SequenceHalfCycles = s_InputCount * (SampleHalfCycles(tSampleTime) + 25u);
+
+        static_assert(tPeriph == Peripheral::ADC_1, "Only ADC1 has a DMA request.");
+        static_assert((s_InputCount >= 1u) && (s_InputCount <= HardwareKernal<1u>::MaxSequence), "A sequence has 1-16 inputs.");
+        static_assert(((tInputs <= HardwareKernal<1u>::MaxInput) && ...), "ADC inputs are 0-17.");
+        static_assert(tAdcClock <= 14'000'000u, "The ADC clock must not exceed 14 MHz.");
+        static_assert((uint64_t{ s_SequenceHalfCycles } * tTriggerRate) < (uint64_t{ tAdcClock } * 2u), "The sequence does not finish before the next trigger.");
+        static_assert(tBlockSize > 0u, "Blocks need at least one sequence.");
+
+        constexpr Properties() noexcept = default;
+    };
+
+    // Converts on every trigger into a circular DMA buffer of two blocks. The block that just filled is passed to
+    // tCallback::Run() from the half and full transfer interrupt, raw codes interleaved in sequence order, while the
+    // DMA fills the other one. The span stays valid until the DMA comes back around, one block time later.
+    template <typename tProperties, typename tCallback>
+    class Module : private tProperties, Common::CallbackFor<tCallback, tProperties>
+    {
+    public:
+        using Block = Common::Containers::Span<uint16_t const>;
+        using Sequence = std::array<uint16_t, tProperties::s_InputCount>;
+
+        template <typename C>
+        Module(C && callback) noexcept
+            : Properties{}
+            , Callback{ std::forward<C>(callback) }
+        {
+            HW::Calibrate();
+            SetSequence(typename tProperties::Inputs{});
+            HW::Registers::CR1().SCAN() = true;
+            // ADON is already set, a write that changes other CR2 bits does not start a conversion
+            HW::Registers::CR2().DMA() = true;
+            HW::Configure(s_Trigger, Alignment::Left);
+
+            DMA_t::Stop();
+            DMA_t::Configure(DMA::Direction::ReadPeripheral, DMA::DataSize::_16bit, DMA::Increment::Memory, DMA::Circular::On, DMA::Priority::High);
+            DMA_t::SetPeripheral(HW::Registers::DR().GetAddress());
+            DMA_t::Acknowledge(DMA_t::Flags::Global);
+            DMA_t::Registers::CCR().HTIE() = true;
+            DMA_t::Registers::CCR().TCIE() = true;
+            DMA_t::Registers::CCR().TEIE() = true;
+            DMA_t::Start(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(s_buffer.data())), Length);
+        }
+        Module(tProperties, tCallback && callback) noexcept
+            : Module{ std::forward<tCallback>(callback) }
+        {}
+        ~Module()
+        {
+            DMA_t::Stop();
+            HW::Disable();
+        }
+
+        // Last sequence the DMA has completely stored, read straight from the buffer it is filling. Used where a block
+        // is too much latency, the DMA only comes back to it a full buffer later.
+        static Sequence Newest() noexcept
+        {
+            size_t const written{ Length - DMA_t::Remaining() };
+            size_t const start{ (((written / s_InputCount) + (Sequences - 1u)) % Sequences) * s_InputCount };
+
+            Sequence sequence{};
+            for (size_t i = 0; i < s_InputCount; ++i) { sequence[i] = s_buffer[start + i]; }
+            return sequence;
+        }
+        static uint32_t Errors() noexcept
+        {
+            return s_errors;
+        }
+        static void Interrupt() noexcept
+        {
+            uint32_t const flags{ DMA_t::Registers::ISR().Read() };
+            DMA_t::Acknowledge(DMA_t::Flags::Global);
+
+            if ((flags & DMA_t::Flags::TransferError) != 0u) { s_errors = s_errors + 1u; }
+            if ((flags & DMA_t::Flags::HalfTransfer) != 0u) { Callback::Run(Block{ s_buffer.data(), BlockLength }); }
+            if ((flags & DMA_t::Flags::TransferComplete) != 0u) { Callback::Run(Block{ s_buffer.data() + BlockLength, BlockLength }); }
+        }
+
+    private:
+        using tProperties::s_Peripheral
+            , tProperties::s_Trigger
+            , tProperties::s_SampleTime
+            , tProperties::s_BlockSize
+            , tProperties::s_Priority
+            , tProperties::s_InputCount;
+
+        using Properties = tProperties;
+        using Callback = Common::CallbackFor<tCallback, tProperties>;
+        using HW = HardwareKernal<Common::Tools::EnumValue(s_Peripheral)>;
+        using DMA_t = DMA::HAL<DMA::Channel::CH_1>;
+
+        using clk_t = CLK::Kernal<ClockID<s_Peripheral>()>;
+        using isr_t = ISR::Kernal<Module, DMA::InterruptSource<DMA::Channel::CH_1>(), s_Priority>;
+
+        static constexpr size_t BlockLength = s_BlockSize * s_InputCount;
+        static constexpr size_t Length = 2u * BlockLength;
+        static constexpr size_t Sequences = 2u * s_BlockSize;
+
+        static_assert(Length <= DMA_t::MaxTransfer, "Two blocks do not fit one DMA transfer.");
+
+        template <unsigned... tInputs>
+        static void SetSequence(std::integer_sequence<unsigned, tInputs...>) noexcept
+        {
+            HW::template SetSequence<tInputs...>(s_SampleTime);
+        }
+
+        inline static std::array<uint16_t, Length> s_buffer{};
+        inline static uint32_t volatile s_errors{ 0 };
+
+    private:
+        clk_t const m_clk{};
+        DMA::clk_t const m_dmaClk{};
+        isr_t const m_isr{};
+    };
+
+    template <typename CFG, typename CB>
+    Module(CFG, CB) -> Module<CFG, CB>;
+}
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "common/tools.hpp"
+#include "common/register.hpp"
+
+#include "macros.h"
+#include "stm32f103xb.h"
+#include "stm32f1xx.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace MCU::ADC
+{
+    inline namespace Settings
+    {
+        // ADC clocks the input is sampled for, a conversion takes another 12.5
+        enum class SampleTime : uint8_t
+        {
+            _1_5 = 0b000,
+            _7_5 = 0b001,
+            _13_5 = 0b010,
+            _28_5 = 0b011,
+            _41_5 = 0b100,
+            _55_5 = 0b101,
+            _71_5 = 0b110,
+            _239_5 = 0b111
+        };
+        // Regular group trigger sources of ADC1 and ADC2
+        enum class Trigger : uint8_t
+        {
+            TIM1_CC1 = 0b000,
+            TIM1_CC2 = 0b001,
+            TIM1_CC3 = 0b010,
+            TIM2_CC2 = 0b011,
+            TIM3_TRGO = 0b100,
+            TIM4_CC4 = 0b101,
+            EXTI11 = 0b110,
+            Software = 0b111
+        };
+        enum class Alignment : bool
+        {
+            Right = false,
+            Left = true
+        };
+    }
+
+    namespace
+    {
+        using namespace Common::Tools;
+
+        // Status register
+        template <uint32_t tAddress>
+        struct SR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto AWD() { return reg_t::template CreateBitfield<ADC_SR_AWD>(); } // Analog watchdog flag
+            auto EOC() { return reg_t::template CreateBitfield<ADC_SR_EOC>(); } // End of conversion
+            auto STRT() { return reg_t::template CreateBitfield<ADC_SR_STRT>(); } // Regular channel start flag
+        };
+
+        // Control register 1
+        template <uint32_t tAddress>
+        struct CR1 : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto EOCIE() { return reg_t::template CreateBitfield<ADC_CR1_EOCIE>(); } // End of conversion interrupt enable
+            auto SCAN() { return reg_t::template CreateBitfield<ADC_CR1_SCAN>(); } // Scan mode
+            auto DISCEN() { return reg_t::template CreateBitfield<ADC_CR1_DISCEN>(); } // Discontinuous mode on regular channels
+        };
+
+        // Control register 2
+        template <uint32_t tAddress>
+        struct CR2 : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto ADON() { return reg_t::template CreateBitfield<ADC_CR2_ADON>(); } // A/D converter on
+            auto CONT() { return reg_t::template CreateBitfield<ADC_CR2_CONT>(); } // Continuous conversion
+            auto CAL() { return reg_t::template CreateBitfield<ADC_CR2_CAL>(); } // Calibration
+            auto RSTCAL() { return reg_t::template CreateBitfield<ADC_CR2_RSTCAL>(); } // Reset calibration
+            auto DMA() { return reg_t::template CreateBitfield<ADC_CR2_DMA>(); } // Direct memory access mode
+            auto ALIGN() { return reg_t::template CreateBitfield<ADC_CR2_ALIGN>(); } // Data alignment
+            auto EXTSEL() { return reg_t::template CreateBitfield<ADC_CR2_EXTSEL>(); } // External event select for regular group
+            auto EXTTRIG() { return reg_t::template CreateBitfield<ADC_CR2_EXTTRIG>(); } // External trigger conversion mode for regular channels
+            auto SWSTART() { return reg_t::template CreateBitfield<ADC_CR2_SWSTART>(); } // Start conversion of regular channels
+        };
+
+        // Sample time register 1 and 2, three bits per channel
+        template <uint32_t tAddress>
+        struct SMPR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+            using reg_t::operator=;
+        };
+
+        // Regular sequence register 1-3, five bits per rank, the length sits in SQR1
+        template <uint32_t tAddress>
+        struct SQR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+            using reg_t::operator=;
+        };
+
+        // Regular data register
+        template <uint32_t tAddress>
+        struct DR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            constexpr auto GetAddress() const noexcept
+            {
+                return tAddress;
+            }
+        };
+    }
+
+    template <unsigned tPeripheral>
+    class HardwareKernal
+    {
+    private:
+        static constexpr uint32_t BaseAddress() noexcept
+        {
+            if constexpr (tPeripheral == 1u) { return ADC1_BASE; }
+            if constexpr (tPeripheral == 2u) { return ADC2_BASE; }
+        }
+
+        using SR_t = SR<BaseAddress() + offsetof(ADC_TypeDef, SR)>;
+        using CR1_t = CR1<BaseAddress() + offsetof(ADC_TypeDef, CR1)>;
+        using CR2_t = CR2<BaseAddress() + offsetof(ADC_TypeDef, CR2)>;
+        using SMPR1_t = SMPR<BaseAddress() + offsetof(ADC_TypeDef, SMPR1)>;
+        using SMPR2_t = SMPR<BaseAddress() + offsetof(ADC_TypeDef, SMPR2)>;
+        using SQR1_t = SQR<BaseAddress() + offsetof(ADC_TypeDef, SQR1)>;
+        using SQR2_t = SQR<BaseAddress() + offsetof(ADC_TypeDef, SQR2)>;
+        using SQR3_t = SQR<BaseAddress() + offsetof(ADC_TypeDef, SQR3)>;
+        using DR_t = DR<BaseAddress() + offsetof(ADC_TypeDef, DR)>;
+
+        ALWAYS_INLINE
+        static auto Field(Trigger const input) noexcept
+        {
+            return Registers::CR2().EXTSEL().Value(EnumValue(input)) | Registers::CR2().EXTTRIG().Value(1u);
+        }
+        ALWAYS_INLINE
+        static auto Field(Alignment const input) noexcept
+        {
+            return Registers::CR2().ALIGN().Value(EnumValue(input));
+        }
+
+    public:
+        using type = HardwareKernal<tPeripheral>;
+
+        // Inputs 16 and 17 are the temperature sensor and the internal reference of ADC1
+        static constexpr unsigned MaxInput = 17u;
+        static constexpr size_t MaxSequence = 16u;
+
+        struct Registers
+        {
+            static SR_t SR() { return {}; }
+            static CR1_t CR1() { return {}; }
+            static CR2_t CR2() { return {}; }
+            static SMPR1_t SMPR1() { return {}; }
+            static SMPR2_t SMPR2() { return {}; }
+            static SQR1_t SQR1() { return {}; }
+            static SQR2_t SQR2() { return {}; }
+            static SQR3_t SQR3() { return {}; }
+            static DR_t DR() { return {}; }
+        };
+
+        template <typename... tArgs>
+        static void Configure(tArgs... args) noexcept
+        {
+            Common::WriteFields(Field(args)...);
+        }
+        // Ranks in conversion order, every input gets the same sample time
+        template <unsigned... tInputs>
+        static void SetSequence(SampleTime const time) noexcept
+        {
+            constexpr unsigned inputs[]{ tInputs... };
+
+            uint32_t smpr1{ 0 };
+            uint32_t smpr2{ 0 };
+            for (unsigned input : inputs)
+            {
+                if (input < 10u) { smpr2 |= uint32_t{ EnumValue(time) } << (3u * input); }
+                else { smpr1 |= uint32_t{ EnumValue(time) } << (3u * (input - 10u)); }
+            }
+
+            uint32_t sqr[3]{ (sizeof...(tInputs) - 1u) << ADC_SQR1_L_Pos, 0u, 0u };
+            for (size_t rank = 0; rank < sizeof...(tInputs); ++rank)
+            {
+                sqr[2u - (rank / 6u)] |= inputs[rank] << (5u * (rank % 6u));
+            }
+
+            Registers::SMPR1() = smpr1;
+            Registers::SMPR2() = smpr2;
+            Registers::SQR1() = sqr[0];
+            Registers::SQR2() = sqr[1];
+            Registers::SQR3() = sqr[2];
+        }
+        // Powers the converter up first. It needs 1us to settle, counted in core clocks at the 72 MHz the part tops out at.
+        static void Calibrate() noexcept
+        {
+            constexpr uint32_t SettleSpins = 72u;
+
+            Enable();
+            for (uint32_t i = 0; i < SettleSpins; ++i) { __NOP(); }
+
+            Registers::CR2().RSTCAL() = true;
+            while (Registers::CR2().RSTCAL()) {}
+            Registers::CR2().CAL() = true;
+            while (Registers::CR2().CAL()) {}
+        }
+        // Setting ADON a second time starts a conversion, so it is only set here
+        ALWAYS_INLINE
+        static void Enable() noexcept
+        {
+            if (!Registers::CR2().ADON().Read()) { Registers::CR2().ADON() = true; }
+        }
+        ALWAYS_INLINE
+        static void Disable() noexcept
+        {
+            Registers::CR2().ADON() = false;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "macros.h"
+
+#include "rcc.hpp"
+#include "interrupt.hpp"
+#include "tim.hpp"
+#include "usart_registers.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MCU::USART
+{
+    // Measures the bit time of a 0x55 sync byte with a timer capture channel wired to the RX pin (USART1 RX on PA10 is
+    // TIM1_CH3). Sent LSB first the byte has falling edges at bit 0, 2, 4, 6 and 8, so five captured falling edges span
+    // exactly eight bit times whatever the rate. The capture only listens to the pin, the USART keeps its setup.
+    template <TIM::Peripheral tTimer, unsigned tChannel, size_t tTimerClock, unsigned tPriority = 5u>
+    class AutoBaud
+    {
+    public:
+        static constexpr uint8_t SyncByte = 0x55u;
+        static constexpr unsigned SyncEdges = 5u;
+        static constexpr unsigned SyncBits = 8u;
+
+        AutoBaud() noexcept
+        {
+            HW::Disable();
+            HW::Configure(TIM::CountDirection::Up, TIM::ClockDivision::Div1);
+            HW::SetPeriod(0u, 0xFFFFu);
+            HW::template ConfigureCapture<tChannel>(TIM::CapturePolarity::Falling, 0u);
+            HW::Enable();
+        }
+        ~AutoBaud() noexcept
+        {
+            HW::template CaptureInterrupt<tChannel>(false);
+            HW::Disable();
+        }
+
+        // Listens for the next sync byte
+        static void Arm() noexcept
+        {
+            HW::template CaptureInterrupt<tChannel>(false);
+            s_edges = 0u;
+            s_result = 0u;
+            HW::Registers::SR().Acknowledge(HW::template CaptureFlag<tChannel>());
+            HW::template CaptureInterrupt<tChannel>(true);
+        }
+        static void Disarm() noexcept
+        {
+            HW::template CaptureInterrupt<tChannel>(false);
+        }
+        // Measured rate, 0 until a sync byte has been seen
+        static uint32_t Result() noexcept
+        {
+            return s_result;
+        }
+        static void Interrupt() noexcept
+        {
+            if ((HW::Registers::SR().Read() & HW::template CaptureFlag<tChannel>()) == 0u) { return; }
+
+            uint16_t const captured{ HW::template Captured<tChannel>() };
+            if (s_edges == 0u) { s_first = captured; }
+
+            s_edges = s_edges + 1u;
+            if (s_edges == SyncEdges)
+            {
+                HW::template CaptureInterrupt<tChannel>(false);
+
+                uint32_t const span{ static_cast<uint16_t>(captured - s_first) };
+                s_result = (span != 0u) ? static_cast<uint32_t>(((uint64_t{ tTimerClock } * SyncBits) + (span / 2u)) / span) : 0u;
+            }
+        }
+
+    private:
+        using HW = TIM::HardwareKernal<Common::Tools::EnumValue(tTimer)>;
+
+        using clk_t = CLK::Kernal<TIM::ClockID<tTimer>()>;
+        using isr_t = ISR::Kernal<AutoBaud, TIM::CaptureInterruptSource<tTimer>(), tPriority>;
+
+        // Eight bit times have to fit the 16 bit counter
+        static_assert((tTimerClock * SyncBits / 9600u) <= 0xFFFFu, "Timer clock is too fast to time a 9600 baud sync byte.");
+
+    private:
+        inline static uint16_t s_first{ 0 };
+        inline static unsigned volatile s_edges{ 0 };
+        inline static uint32_t volatile s_result{ 0 };
+
+        clk_t const m_clk{};
+        isr_t const m_isr{};
+    };
+}
\ No newline at end of file
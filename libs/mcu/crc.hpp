@@ -0,0 +1,45 @@
+#pragma once
+
+#include "macros.h"
+
+#include "rcc.hpp"
+#include "crc_registers.hpp"
+
+#include <cstdint>
+
+namespace MCU::CRC32
+{
+    using clk_t = CLK::Kernal<CLK::ClockID::AHB_CRC>;
+
+    // CRC-32/MPEG-2 over whole words: polynomial 0x04C11DB7, initial value 0xFFFFFFFF, MSB first, no reflection and
+    // no final XOR. A word takes four AHB cycles, so feeding it back to back never stalls.
+    class Module
+    {
+    public:
+        using HW = HardwareKernal;
+
+        Module() noexcept
+        {
+            HW::Reset();
+        }
+
+        ALWAYS_INLINE
+        static void Reset() noexcept
+        {
+            HW::Reset();
+        }
+        ALWAYS_INLINE
+        static void Feed(uint32_t const word) noexcept
+        {
+            HW::Feed(word);
+        }
+        ALWAYS_INLINE
+        static uint32_t Value() noexcept
+        {
+            return HW::Value();
+        }
+
+    private:
+        clk_t const m_clk{};
+    };
+}
\ No newline at end of file
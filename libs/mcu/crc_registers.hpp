@@ -0,0 +1,70 @@
+#pragma once
+
+#include "common/tools.hpp"
+#include "common/register.hpp"
+
+#include "macros.h"
+#include "stm32f103xb.h"
+#include "stm32f1xx.h"
+#include <cstddef>
+#include <cstdint>
+
+// 'CRC' is the CMSIS peripheral pointer macro
+namespace MCU::CRC32
+{
+    namespace
+    {
+        using namespace Common::Tools;
+
+        // Data register, writes feed the calculation and reads return the result
+        template <uint32_t tAddress>
+        struct DR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+            using reg_t::operator=;
+        };
+
+        // Control register
+        template <uint32_t tAddress>
+        struct CR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto RESET() { return reg_t::template CreateBitfield<CRC_CR_RESET>(); } // Reset the data register to 0xFFFFFFFF
+        };
+    }
+
+    class HardwareKernal
+    {
+    private:
+        using DR_t = DR<CRC_BASE + offsetof(CRC_TypeDef, DR)>;
+        using CR_t = CR<CRC_BASE + offsetof(CRC_TypeDef, CR)>;
+
+    public:
+        using type = HardwareKernal;
+
+        struct Registers
+        {
+            static DR_t DR() { return {}; }
+            static CR_t CR() { return {}; }
+        };
+
+        ALWAYS_INLINE
+        static void Reset() noexcept
+        {
+            Registers::CR().RESET() = true;
+        }
+        ALWAYS_INLINE
+        static void Feed(uint32_t const word) noexcept
+        {
+            Registers::DR() = word;
+        }
+        ALWAYS_INLINE
+        static uint32_t Value() noexcept
+        {
+            return Registers::DR().Read();
+        }
+    };
+}
\ No newline at end of file
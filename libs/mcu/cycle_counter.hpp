@@ -0,0 +1,31 @@
+#pragma once
+
+#include "macros.h"
+
+#include "stm32f1xx.h"
+
+#include <cstdint>
+
+namespace MCU::TRACE
+{
+    // Free running core clock counter of the DWT unit
+    struct CycleCounter
+    {
+        static void Enable() noexcept
+        {
+            CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+            DWT->CYCCNT = 0u;
+            DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+        }
+        ALWAYS_INLINE
+        static uint32_t Now() noexcept
+        {
+            return DWT->CYCCNT;
+        }
+        ALWAYS_INLINE
+        static uint32_t Since(uint32_t const start) noexcept
+        {
+            return (Now() - start);
+        }
+    };
+}
\ No newline at end of file
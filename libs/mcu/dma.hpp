@@ -1,8 +1,41 @@
 #pragma once
 
+#include "rcc.hpp"
+#include "interrupt.hpp"
 #include "dma_registers.hpp"
 
-namespace Peripherals::DMA
+#include <cstdint>
+
+namespace MCU::DMA
 {
+    enum class Channel : uint8_t
+    {
+        CH_1 = 1u,
+        CH_2,
+        CH_3,
+        CH_4,
+        CH_5,
+        CH_6,
+        CH_7
+    };
+
+    namespace
+    {
+        template <Channel tChannel>
+        constexpr auto InterruptSource() noexcept
+        {
+            if constexpr (tChannel == Channel::CH_1) { return MCU::ISR::InterruptSource::eDMA1_Channel1; }
+            if constexpr (tChannel == Channel::CH_2) { return MCU::ISR::InterruptSource::eDMA1_Channel2; }
+            if constexpr (tChannel == Channel::CH_3) { return MCU::ISR::InterruptSource::eDMA1_Channel3; }
+            if constexpr (tChannel == Channel::CH_4) { return MCU::ISR::InterruptSource::eDMA1_Channel4; }
+            if constexpr (tChannel == Channel::CH_5) { return MCU::ISR::InterruptSource::eDMA1_Channel5; }
+            if constexpr (tChannel == Channel::CH_6) { return MCU::ISR::InterruptSource::eDMA1_Channel6; }
+            if constexpr (tChannel == Channel::CH_7) { return MCU::ISR::InterruptSource::eDMA1_Channel7; }
+        }
+    }
+
+    using clk_t = CLK::Kernal<CLK::ClockID::AHB_DMA1>;
 
+    template <Channel tChannel>
+    using HAL = HardwareKernal<Common::Tools::EnumValue(tChannel)>;
 }
\ No newline at end of file
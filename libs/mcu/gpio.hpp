@@ -3,6 +3,10 @@
 #include "rcc.hpp"
 #include "gpio_registers.hpp"
 
+#include <bit>
+#include <cstdint>
+#include <tuple>
+
 namespace MCU::IO 
 {
     enum class Port : uint8_t
@@ -36,10 +40,11 @@ namespace MCU::IO
         static constexpr size_t Pin = tPin;
 
     public:
+        // CRL/CRH and ODR take one write each whatever the settings
         template <typename... Args>
         Module(Args... args) noexcept
         {
-            ( HAL::Set(args), ... );
+            Common::WriteFields(HAL::Field(args)...);
         }
         template <typename T>
         Module & operator = (T input) noexcept
@@ -52,9 +57,17 @@ namespace MCU::IO
             HAL::Set((State)input);
             return *this;
         }
+        static void Write(State const input) noexcept
+        {
+            HAL::Set(input);
+        }
+        static bool Read() noexcept
+        {
+            return HAL::Get();
+        }
         static void Toggle() noexcept
         {
-            
+            HAL::Toggle();
         }
         static bool Lock() noexcept
         {
@@ -73,6 +86,214 @@ namespace MCU::IO
         CLK_t const m_clk{};
     };
 
+    // Pins of one port driven together. Every write is a single BSRR store, so the pins switch on the same cycle and
+    // an interrupt driving other pins of the port cannot tear it. Configuration and clocking stay with the pins.
+    template <typename... tPins>
+    class PinGroup
+    {
+    private:
+        using First = std::tuple_element_t<0, std::tuple<tPins...>>;
+
+    public:
+        static constexpr size_t Port = First::Port;
+        static constexpr uint32_t Mask = (0u | ... | (GPIO_ODR_ODR0 << tPins::Pin));
+
+        static_assert(((tPins::Port == Port) && ...), "Pins of a group have to share one port.");
+        static_assert(static_cast<size_t>(std::popcount(Mask)) == sizeof...(tPins), "A pin appears twice in the group.");
+
+        static void Set() noexcept
+        {
+            Store(Mask);
+        }
+        static void Reset() noexcept
+        {
+            Store(0u);
+        }
+        static void Write(State const input) noexcept
+        {
+            Store((input == State::High) ? Mask : 0u);
+        }
+        // One state per pin in group order, the store is a constant
+        template <State... tStates>
+        static void Write() noexcept
+        {
+            static_assert(sizeof...(tStates) == sizeof...(tPins), "One state per pin.");
+            Store((0u | ... | ((tStates == State::High) ? (GPIO_ODR_ODR0 << tPins::Pin) : 0u)));
+        }
+        // 'levels' in port bit positions, bits outside the group are ignored
+        static void Write(uint32_t const levels) noexcept
+        {
+            Store(levels);
+        }
+        static void Toggle() noexcept
+        {
+            Store(~HAL::Registers::ODR().Read());
+        }
+        // Input levels in port bit positions
+        static uint32_t Read() noexcept
+        {
+            return (HAL::Registers::IDR().Read() & Mask);
+        }
+
+    private:
+        using HAL = IPeripheral<Port, First::Pin>;
+
+        ALWAYS_INLINE
+        static void Store(uint32_t const levels) noexcept
+        {
+            HAL::Registers::BSRR().Write((levels & Mask) | ((~levels & Mask) << 16u));
+        }
+    };
+
+    // Mode and CNF nibble plus ODR level of one pin, starting from the reset state (floating input, low)
+    struct PinSetup
+    {
+        uint32_t Mode;
+        uint32_t Config;
+        bool Level;
+    };
+
+    namespace
+    {
+        constexpr void Apply(PinSetup & setup, Input const input) noexcept
+        {
+            setup.Mode = 0u;
+            setup.Config = Common::Tools::EnumValue(input);
+        }
+        constexpr void Apply(PinSetup & setup, Output const input) noexcept
+        {
+            setup.Mode = 1u;
+            setup.Config = Common::Tools::EnumValue(input);
+        }
+        constexpr void Apply(PinSetup & setup, Alternate const input) noexcept
+        {
+            setup.Mode = 1u;
+            setup.Config = Common::Tools::EnumValue(input);
+        }
+        constexpr void Apply(PinSetup & setup, OutputSpeed const input) noexcept
+        {
+            setup.Mode = Common::Tools::EnumValue(input);
+        }
+        constexpr void Apply(PinSetup & setup, PullResistor const input) noexcept
+        {
+            setup.Level = (input == PullResistor::PullUp);
+        }
+        constexpr void Apply(PinSetup & setup, State const input) noexcept
+        {
+            setup.Level = (input == State::High);
+        }
+    }
+
+    // One pin of a PinMap with the settings IO::Module would take, later settings win like they do there
+    template <typename tPin, auto... tSettings>
+    struct Claim
+    {
+        using Pin = tPin;
+
+        static constexpr size_t Port = tPin::Port;
+        static constexpr size_t Number = tPin::Pin;
+        static constexpr PinSetup Setup = []() noexcept
+        {
+            PinSetup setup{ 0b00u, 0b01u, false };
+            ( Apply(setup, tSettings), ... );
+            return setup;
+        }();
+        static constexpr uint32_t Nibble = (Setup.Mode | (Setup.Config << 2u));
+    };
+
+    // A pin whose configuration comes from the board PinMap, constructing it only holds the port clock
+    template <typename tPin>
+    struct Mapped : tPin
+    {
+        using tPin::operator=;
+
+        template <typename... tArgs>
+        Mapped(tArgs...) noexcept
+            : tPin{}
+        {}
+    };
+
+    // Every pin of the board configured at once: the claims are folded at compile time into one value per CRL, CRH
+    // and ODR of each port they touch, and each register takes a single store, ODR first so outputs come up at their
+    // level. Pins without a claim on a touched register go back to their reset state, so the map is built before any
+    // driver. A pin claimed twice does not compile.
+    template <typename... tClaims>
+    class PinMap
+    {
+    private:
+        template <typename tPin>
+        static constexpr size_t Count() noexcept
+        {
+            return (0u + ... + size_t{ (tClaims::Port == tPin::Port) && (tClaims::Number == tPin::Pin) });
+        }
+
+    public:
+        static_assert(((Count<typename tClaims::Pin>() == 1u) && ...), "A pin is claimed twice.");
+
+        template <typename tPin>
+        static constexpr bool Claims() noexcept
+        {
+            return (Count<tPin>() != 0u);
+        }
+
+    private:
+        template <typename tPin>
+        struct Checked
+        {
+            static_assert(Claims<tPin>(), "The pin is not claimed by the board map.");
+            using Type = Mapped<tPin>;
+        };
+
+    public:
+        // Pin type for a driver, configured by the map instead of its own constructor
+        template <typename tPin>
+        using Pin = typename Checked<tPin>::Type;
+
+        PinMap() noexcept
+        {
+            Store<0u>();
+            Store<1u>();
+            Store<2u>();
+            Store<3u>();
+            Store<4u>();
+        }
+
+    private:
+        template <size_t tPort>
+        static constexpr uint32_t Claimed() noexcept
+        {
+            return (0u | ... | ((tClaims::Port == tPort) ? (GPIO_ODR_ODR0 << tClaims::Number) : 0u));
+        }
+        template <size_t tPort>
+        static constexpr uint32_t Levels() noexcept
+        {
+            return (0u | ... | (((tClaims::Port == tPort) && tClaims::Setup.Level) ? (GPIO_ODR_ODR0 << tClaims::Number) : 0u));
+        }
+        // Configuration of pins tFirst to tFirst + 7, unclaimed ones read as floating inputs
+        template <size_t tPort, size_t tFirst>
+        static constexpr uint32_t Config() noexcept
+        {
+            uint32_t value{ 0x4444'4444u };
+            ( (((tClaims::Port == tPort) && (tClaims::Number >= tFirst) && (tClaims::Number < (tFirst + 8u)))
+                ? (value = (value & ~(0xFu << (4u * (tClaims::Number - tFirst)))) | (tClaims::Nibble << (4u * (tClaims::Number - tFirst))))
+                : value), ... );
+            return value;
+        }
+        template <size_t tPort>
+        static void Store() noexcept
+        {
+            if constexpr (Claimed<tPort>() != 0u)
+            {
+                IPeripheral<tPort, 0u>::Registers::ODR().Write(Levels<tPort>());
+                if constexpr ((Claimed<tPort>() & 0x00FFu) != 0u) { IPeripheral<tPort, 0u>::Registers::CRx().Write(Config<tPort, 0u>()); }
+                if constexpr ((Claimed<tPort>() & 0xFF00u) != 0u) { IPeripheral<tPort, 8u>::Registers::CRx().Write(Config<tPort, 8u>()); }
+            }
+        }
+
+    private:
+        std::tuple<CLK::Kernal<ClockID<static_cast<IO::Port>(tClaims::Port)>()>...> const m_clocks{};
+    };
+
     struct NoPin
     {
         NoPin(...) {}
@@ -141,56 +141,31 @@ namespace MCU::IO
             ODR_t & operator = (bool const rhs) noexcept
             {
                 OD() = rhs;
+                return *this;
             }
         };
 
+        // Write only, a store of the pin's bit changes that pin alone
         template <unsigned tPort, unsigned tPin, uint32_t tAddress>
         struct BSRR_t : public u32_reg_t<tAddress>
         {
             using reg_t = u32_reg_t<tAddress>;
             using reg_t::reg_t;
 
+            static constexpr uint32_t SetMask = (GPIO_BSRR_BS0 << tPin);
+            static constexpr uint32_t ResetMask = (GPIO_BSRR_BR0 << tPin);
+
             void Set()
             {
-                if constexpr (tPin == 15) { reg_t::template CreateBitfield<GPIO_BSRR_BS15>() = true; }
-                if constexpr (tPin == 14) { reg_t::template CreateBitfield<GPIO_BSRR_BS14>() = true; }
-                if constexpr (tPin == 13) { reg_t::template CreateBitfield<GPIO_BSRR_BS13>() = true; }
-                if constexpr (tPin == 12) { reg_t::template CreateBitfield<GPIO_BSRR_BS12>() = true; }
-                if constexpr (tPin == 11) { reg_t::template CreateBitfield<GPIO_BSRR_BS11>() = true; }
-                if constexpr (tPin == 10) { reg_t::template CreateBitfield<GPIO_BSRR_BS10>() = true; }
-                if constexpr (tPin == 9) { reg_t::template CreateBitfield<GPIO_BSRR_BS9>() = true; }
-                if constexpr (tPin == 8) { reg_t::template CreateBitfield<GPIO_BSRR_BS8>() = true; }
-                if constexpr (tPin == 7) { reg_t::template CreateBitfield<GPIO_BSRR_BS7>() = true; }
-                if constexpr (tPin == 6) { reg_t::template CreateBitfield<GPIO_BSRR_BS6>() = true; }
-                if constexpr (tPin == 5) { reg_t::template CreateBitfield<GPIO_BSRR_BS5>() = true; }
-                if constexpr (tPin == 4) { reg_t::template CreateBitfield<GPIO_BSRR_BS4>() = true; }
-                if constexpr (tPin == 3) { reg_t::template CreateBitfield<GPIO_BSRR_BS3>() = true; }
-                if constexpr (tPin == 2) { reg_t::template CreateBitfield<GPIO_BSRR_BS2>() = true; }
-                if constexpr (tPin == 1) { reg_t::template CreateBitfield<GPIO_BSRR_BS1>() = true; }
-                if constexpr (tPin == 0) { reg_t::template CreateBitfield<GPIO_BSRR_BS0>() = true; }
+                reg_t::Write(SetMask);
             }
             void Reset()
             {
-                if constexpr (tPin == 15) { reg_t::template CreateBitfield<GPIO_BSRR_BR15>() = true; }
-                if constexpr (tPin == 14) { reg_t::template CreateBitfield<GPIO_BSRR_BR14>() = true; }
-                if constexpr (tPin == 13) { reg_t::template CreateBitfield<GPIO_BSRR_BR13>() = true; }
-                if constexpr (tPin == 12) { reg_t::template CreateBitfield<GPIO_BSRR_BR12>() = true; }
-                if constexpr (tPin == 11) { reg_t::template CreateBitfield<GPIO_BSRR_BR11>() = true; }
-                if constexpr (tPin == 10) { reg_t::template CreateBitfield<GPIO_BSRR_BR10>() = true; }
-                if constexpr (tPin == 9) { reg_t::template CreateBitfield<GPIO_BSRR_BR9>() = true; }
-                if constexpr (tPin == 8) { reg_t::template CreateBitfield<GPIO_BSRR_BR8>() = true; }
-                if constexpr (tPin == 7) { reg_t::template CreateBitfield<GPIO_BSRR_BR7>() = true; }
-                if constexpr (tPin == 6) { reg_t::template CreateBitfield<GPIO_BSRR_BR6>() = true; }
-                if constexpr (tPin == 5) { reg_t::template CreateBitfield<GPIO_BSRR_BR5>() = true; }
-                if constexpr (tPin == 4) { reg_t::template CreateBitfield<GPIO_BSRR_BR4>() = true; }
-                if constexpr (tPin == 3) { reg_t::template CreateBitfield<GPIO_BSRR_BR3>() = true; }
-                if constexpr (tPin == 2) { reg_t::template CreateBitfield<GPIO_BSRR_BR2>() = true; }
-                if constexpr (tPin == 1) { reg_t::template CreateBitfield<GPIO_BSRR_BR1>() = true; }
-                if constexpr (tPin == 0) { reg_t::template CreateBitfield<GPIO_BSRR_BR0>() = true; }
+                reg_t::Write(ResetMask);
             }
             BSRR_t & operator = (bool const input) noexcept
             {
-                (input) ? Set() : Reset();
+                reg_t::Write((input) ? SetMask : ResetMask);
                 return *this;
             }
         };
@@ -203,22 +178,7 @@ namespace MCU::IO
 
             void Reset()
             {
-                if constexpr (tPin == 15) { reg_t::template CreateBitfield<GPIO_BRR_BR15>() = true; }
-                if constexpr (tPin == 14) { reg_t::template CreateBitfield<GPIO_BRR_BR14>() = true; }
-                if constexpr (tPin == 13) { reg_t::template CreateBitfield<GPIO_BRR_BR13>() = true; }
-                if constexpr (tPin == 12) { reg_t::template CreateBitfield<GPIO_BRR_BR12>() = true; }
-                if constexpr (tPin == 11) { reg_t::template CreateBitfield<GPIO_BRR_BR11>() = true; }
-                if constexpr (tPin == 10) { reg_t::template CreateBitfield<GPIO_BRR_BR10>() = true; }
-                if constexpr (tPin == 9) { reg_t::template CreateBitfield<GPIO_BRR_BR9>() = true; }
-                if constexpr (tPin == 8) { reg_t::template CreateBitfield<GPIO_BRR_BR8>() = true; }
-                if constexpr (tPin == 7) { reg_t::template CreateBitfield<GPIO_BRR_BR7>() = true; }
-                if constexpr (tPin == 6) { reg_t::template CreateBitfield<GPIO_BRR_BR6>() = true; }
-                if constexpr (tPin == 5) { reg_t::template CreateBitfield<GPIO_BRR_BR5>() = true; }
-                if constexpr (tPin == 4) { reg_t::template CreateBitfield<GPIO_BRR_BR4>() = true; }
-                if constexpr (tPin == 3) { reg_t::template CreateBitfield<GPIO_BRR_BR3>() = true; }
-                if constexpr (tPin == 2) { reg_t::template CreateBitfield<GPIO_BRR_BR2>() = true; }
-                if constexpr (tPin == 1) { reg_t::template CreateBitfield<GPIO_BRR_BR1>() = true; }
-                if constexpr (tPin == 0) { reg_t::template CreateBitfield<GPIO_BRR_BR0>() = true; }
+                reg_t::Write(GPIO_BRR_BR0 << tPin);
             }
         };
 
@@ -368,6 +328,50 @@ namespace MCU::IO
         {
             Registers::BSRR() = Common::Tools::EnumValue(input);
         }
+        // Reads ODR and inverts through BSRR, one store that leaves the other pins alone
+        ALWAYS_INLINE
+        static void Toggle() noexcept
+        {
+            using BSRR = decltype(Registers::BSRR());
+            bool const high{ (Registers::ODR().Read() & (GPIO_ODR_ODR0 << tPin)) != 0u };
+            Registers::BSRR().Write((high) ? BSRR::ResetMask : BSRR::SetMask);
+        }
+        // Configuration as field values, see Common::WriteFields(). The level of an output goes to ODR.
+        ALWAYS_INLINE
+        static auto Field(Input const input) noexcept
+        {
+            return Registers::CRx().MODE().Value(0u) | Registers::CRx().CNF().Value(Common::Tools::EnumValue(input));
+        }
+        ALWAYS_INLINE
+        static auto Field(Output const input) noexcept
+        {
+            return Registers::CRx().MODE().Value(1u) | Registers::CRx().CNF().Value(Common::Tools::EnumValue(input));
+        }
+        ALWAYS_INLINE
+        static auto Field(Alternate const input) noexcept
+        {
+            return Registers::CRx().MODE().Value(1u) | Registers::CRx().CNF().Value(Common::Tools::EnumValue(input));
+        }
+        ALWAYS_INLINE
+        static auto Field(OutputSpeed const input) noexcept
+        {
+            return Registers::CRx().MODE().Value(Common::Tools::EnumValue(input));
+        }
+        ALWAYS_INLINE
+        static auto Field(PullResistor const input) noexcept
+        {
+            return Registers::ODR().OD().Value(Common::Tools::EnumValue(input));
+        }
+        ALWAYS_INLINE
+        static auto Field(State const input) noexcept
+        {
+            return Registers::ODR().OD().Value(Common::Tools::EnumValue(input));
+        }
+        ALWAYS_INLINE 
+        static bool Get() noexcept
+        {
+            return Registers::IDR().ID();
+        }
         static bool IsLocked() noexcept
         {
             return Registers::LCKR().LCKK();
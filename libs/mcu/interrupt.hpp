@@ -2,6 +2,7 @@
 
 #include "macros.h"
 
+#include "common/atomic.hpp"
 #include "common/tools.hpp"
 
 #include "stm32f1xx.h"
@@ -92,15 +93,7 @@ namespace MCU::ISR
         ALWAYS_INLINE 
         static bool Register(void_function_t && callback) noexcept
         {
-            void_function_t * const volatile ptr = &s_callback;
-
-            if (*ptr == nullptr)
-            {
-                *ptr = callback;
-                return true;
-            }
-
-            return false;
+            return Common::Atomic::CompareExchange(s_callback, void_function_t{ nullptr }, callback);
         }
         ALWAYS_INLINE 
         static bool Unregister() noexcept
@@ -115,7 +108,7 @@ namespace MCU::ISR
         }
 
     private:
-        inline static void_function_t s_callback{ nullptr };
+        inline static void_function_t volatile s_callback{ nullptr };
     };
     
     template <class tModule, InterruptSource tSource, unsigned tPriority = 5u>
@@ -207,6 +207,22 @@ namespace MCU::CLK
         {
             return (AHB_ClockFreq() >> PCLK1_DivShift());
         }
+        // ADCPRE is left at its reset divider
+        ALWAYS_INLINE
+        static constexpr std::uint32_t ADC_ClockFreq() noexcept
+        {
+            return (APB2_ClockFreq() / 2u);
+        }
+        ALWAYS_INLINE
+        static constexpr std::uint32_t APB2_TimerClockFreq() noexcept
+        {
+            return (s_APB2_Prescale == PCLK2_Prescaler::Div_1) ? APB2_ClockFreq() : (APB2_ClockFreq() * 2u);
+        }
+        ALWAYS_INLINE
+        static constexpr std::uint32_t APB1_TimerClockFreq() noexcept
+        {
+            return (s_APB1_Prescale == PCLK1_Prescaler::Div_1) ? APB1_ClockFreq() : (APB1_ClockFreq() * 2u);
+        }
         ALWAYS_INLINE
         static constexpr std::uint32_t PLL_ClockFreq() noexcept
         {
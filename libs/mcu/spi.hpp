@@ -1,6 +1,6 @@
 #pragma once
 
-#include "common/static_lambda.hpp"
+#include "common/delegate.hpp"
 #include "common/tools.hpp"
 #include "mcu/gpio.hpp"
 #include "mcu/interrupt.hpp"
@@ -50,6 +50,7 @@ namespace MCU::SPI
         , ClockPolarity tClkPolarity = ClockPolarity::Low
         , ClockPrescaler tClkDiv = ClockPrescaler::Div8
         , DataDirection tDirection = DataDirection::FullDuplex
+        , unsigned tPriority = 5u
     >
     struct Configuration : tSCLK, tMOSI, tMISO
     {
@@ -66,14 +67,13 @@ namespace MCU::SPI
         static constexpr auto s_Polarity = tClkPolarity;
         static constexpr auto s_ClockDiv = tClkDiv;
         static constexpr auto s_DataDirection = tDirection;
+        static constexpr auto s_Priority = tPriority;
 
         constexpr Configuration() noexcept
             : tSCLK{ IO::Alternate::PushPull, IO::OutputSpeed::_50MHz }
             , tMOSI{ IO::Alternate::PushPull, IO::OutputSpeed::_50MHz }
             , tMISO{ IO::Input::Floating }
-        {
-            HAL::Set(tMode);
-        }
+        {}
 
     //private:
     //    sclk_pin_t const m_sclk{ IO::Alternate::PushPull, IO::OutputSpeed::_50MHz };
@@ -82,7 +82,7 @@ namespace MCU::SPI
     };
 
     template <typename tConfig, typename tCallback>
-    class Module : private tConfig, Common::StaticLambda<tCallback>
+    class Module : private tConfig
     {
     private:
         using Config = tConfig;
@@ -93,16 +93,19 @@ namespace MCU::SPI
             , Config::s_Phase
             , Config::s_Polarity
             , Config::s_ClockDiv
-            , Config::s_DataDirection;
+            , Config::s_DataDirection
+            , Config::s_Priority;
 
     public:
         template <typename C>
         Module(C && callback) noexcept
-            : Config{ s_Mode, s_BitOrder, s_DataWidth, s_Phase, s_Polarity, s_ClockDiv, s_DataDirection }
+            : Config{}
             , m_Callback{ std::forward<C>(callback) }
             , m_CLK{}
             , m_ISR{}
         {
+            HAL::Disable();
+            HAL::Configure(s_Mode, s_BitOrder, s_DataWidth, s_Phase, s_Polarity, s_ClockDiv, s_DataDirection);
             HAL::Enable();
         }
         Module(tConfig, tCallback && callback) noexcept
@@ -113,14 +116,20 @@ namespace MCU::SPI
             HAL::Disable();
         }
 
+        static void Interrupt() noexcept
+        {
+            Callback::Run();
+        }
+
     private:
         //using Registers = typename Peripheral<Common::Tools::EnumValue(s_PeriphID)>::Type;
         using HAL = typename Config::HAL;
-        using REG = typename Config::Registers;
+        using REG = typename Config::REGS;
+        using Callback = Common::CallbackFor<tCallback, tConfig>;
 
-        Common::StaticLambda<tCallback> const m_Callback;
+        Callback const m_Callback;
         CLK::Kernal<ClockID<s_PeriphID>()> const m_CLK;
-        ISR::Kernal<Module, InterruptSource<s_PeriphID>()> const m_ISR;
+        ISR::Kernal<Module, InterruptSource<s_PeriphID>(), s_Priority> const m_ISR;
     };
 
     template <typename P, typename C>
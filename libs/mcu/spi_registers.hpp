@@ -212,43 +212,64 @@ namespace MCU::SPI
         {
             return Registers::DR().GetAddress();
         }
+        // Every setting lives in CR1, which takes a single write
+        template <typename... tArgs>
+        static void Configure(tArgs... args) noexcept
+        {
+            Common::WriteFields(Field(args)...);
+        }
+        ALWAYS_INLINE
+        static void Write(uint16_t const data) noexcept
+        {
+            while (!Registers::SR().TXE());
+            Registers::DR() = data;
+        }
+        ALWAYS_INLINE
+        static void Flush() noexcept
+        {
+            while (!Registers::SR().TXE());
+            while (Registers::SR().BSY());
+        }
 
         ALWAYS_INLINE
-        static void Set(DataDirection const input) noexcept
+        static auto Field(DataDirection const input) noexcept
         {
-            Registers::CR1().BIDIMODE() = ((EnumValue(input) >> 2u) & 1u);
-            Registers::CR1().BIDIOE() = ((EnumValue(input) >> 1u) & 1u);
-            Registers::CR1().RXONLY() = ((EnumValue(input) >> 0u) & 1u);
+            return Registers::CR1().BIDIMODE().Value((EnumValue(input) >> 2u) & 1u)
+                | Registers::CR1().BIDIOE().Value((EnumValue(input) >> 1u) & 1u)
+                | Registers::CR1().RXONLY().Value((EnumValue(input) >> 0u) & 1u);
         }
         ALWAYS_INLINE
-        static void Set(DataWidth const input) noexcept
+        static auto Field(DataWidth const input) noexcept
         {
-            Registers::CR1().DFF() = EnumValue(input);
+            return Registers::CR1().DFF().Value(EnumValue(input));
         }
         ALWAYS_INLINE
-        static void Set(BitOrder const input) noexcept
+        static auto Field(BitOrder const input) noexcept
         {
-            Registers::CR1().LSBFIRST() = EnumValue(input);
+            return Registers::CR1().LSBFIRST().Value(EnumValue(input));
         }
         ALWAYS_INLINE
-        static void Set(ClockPrescaler const input) noexcept
+        static auto Field(ClockPrescaler const input) noexcept
         {
-            Registers::CR1().BR() = EnumValue(input);
+            return Registers::CR1().BR().Value(EnumValue(input));
         }
         ALWAYS_INLINE
-        static void Set(Mode const input) noexcept
+        static auto Field(Mode const input) noexcept
         {
-            Registers::CR1().MSTR() = EnumValue(input);
+            // Master without a hardware NSS pin needs SSI held high or the peripheral faults into slave mode
+            return Registers::CR1().SSM().Value(EnumValue(input))
+                | Registers::CR1().SSI().Value(EnumValue(input))
+                | Registers::CR1().MSTR().Value(EnumValue(input));
         }
         ALWAYS_INLINE
-        static void Set(ClockPhase const input) noexcept
+        static auto Field(ClockPhase const input) noexcept
         {
-            Registers::CR1().CPHA() = EnumValue(input);
+            return Registers::CR1().CPHA().Value(EnumValue(input));
         }
         ALWAYS_INLINE
-        static void Set(ClockPolarity const input) noexcept
+        static auto Field(ClockPolarity const input) noexcept
         {
-            Registers::CR1().CPOL() = EnumValue(input);
+            return Registers::CR1().CPOL().Value(EnumValue(input));
         }
 
         template <typename, typename>
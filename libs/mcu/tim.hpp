@@ -0,0 +1,186 @@
+#pragma once
+
+#include "macros.h"
+
+#include "rcc.hpp"
+#include "interrupt.hpp"
+#include "tim_registers.hpp"
+
+#include "common/delegate.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MCU::TIM
+{
+    enum class Peripheral : uint8_t
+    {
+        TIM_1 = 1u,
+        TIM_2,
+        TIM_3,
+        TIM_4
+    };
+
+    namespace {
+        template <Peripheral tPeriph>
+        constexpr auto ClockID() noexcept
+        {
+            if constexpr (tPeriph == Peripheral::TIM_1) { return CLK::ClockID::APB2_TIM1; }
+            if constexpr (tPeriph == Peripheral::TIM_2) { return CLK::ClockID::APB1_TIM2; }
+            if constexpr (tPeriph == Peripheral::TIM_3) { return CLK::ClockID::APB1_TIM3; }
+            if constexpr (tPeriph == Peripheral::TIM_4) { return CLK::ClockID::APB1_TIM4; }
+        }
+        template <Peripheral tPeriph>
+        constexpr auto InterruptSource() noexcept
+        {
+            if constexpr (tPeriph == Peripheral::TIM_1) { return ISR::InterruptSource::eTIM1_UP; }
+            if constexpr (tPeriph == Peripheral::TIM_2) { return ISR::InterruptSource::eTIM2; }
+            if constexpr (tPeriph == Peripheral::TIM_3) { return ISR::InterruptSource::eTIM3; }
+            if constexpr (tPeriph == Peripheral::TIM_4) { return ISR::InterruptSource::eTIM4; }
+        }
+        // TIM1 has a separate capture/compare vector, the others share their global one
+        template <Peripheral tPeriph>
+        constexpr auto CaptureInterruptSource() noexcept
+        {
+            if constexpr (tPeriph == Peripheral::TIM_1) { return ISR::InterruptSource::eTIM1_CC; }
+            else { return InterruptSource<tPeriph>(); }
+        }
+    }
+
+    template
+    <
+        Peripheral tPeriph
+        , size_t tTimerClock
+        , size_t tUpdateFreq
+        , unsigned tPriority = 0u
+    >
+    struct Properties
+    {
+        static constexpr auto s_Peripheral = tPeriph;
+        static constexpr auto s_TimerClockFreq = tTimerClock;
+        static constexpr auto s_UpdateFreq = tUpdateFreq;
+        static constexpr auto s_Priority = tPriority;
+
+        // Smallest prescaler that keeps the reload inside 16 bits gives the finest period resolution
+        static constexpr uint32_t s_Prescaler = static_cast<uint32_t>(((tTimerClock / tUpdateFreq) - 1u) / 0x10000u);
+        static constexpr uint32_t s_Reload = static_cast<uint32_t>((tTimerClock / ((s_Prescaler + 1u) * tUpdateFreq)) - 1u);
+        static constexpr uint32_t s_PeriodTicks = s_Reload + 1u;
+
+        static_assert((tUpdateFreq > 0u) && (tUpdateFreq <= (tTimerClock / 2u)), "Update frequency is out of range for the timer clock.");
+        static_assert(s_Prescaler <= 0xFFFFu, "Update frequency is too low for a 16 bit prescaler.");
+
+        constexpr Properties() noexcept = default;
+    };
+
+    template <typename tProperties, typename tCallback>
+    class Module : private tProperties, Common::CallbackFor<tCallback, tProperties>
+    {
+    public:
+        template <typename C>
+        Module(C && callback) noexcept
+            : Properties{}
+            , Callback{ std::forward<C>(callback) }
+        {
+            HW::Configure(CountDirection::Up, ClockDivision::Div1);
+            HW::SetPeriod(s_Prescaler, s_Reload);
+
+            HW::Registers::CR1().ARPE() = true;
+            HW::Registers::DIER().UIE() = true;
+        }
+        Module(tProperties, tCallback && callback) noexcept
+            : Module{ std::forward<tCallback>(callback) }
+        {}
+        ~Module()
+        {
+            HW::Disable();
+            HW::Registers::DIER().UIE() = false;
+        }
+
+        static void Start() noexcept
+        {
+            HW::Registers::CNT() = 0u;
+            HW::Enable();
+        }
+        static void Stop() noexcept
+        {
+            HW::Disable();
+        }
+        static uint32_t Counter() noexcept
+        {
+            return HW::Counter();
+        }
+        static constexpr uint32_t PeriodTicks() noexcept
+        {
+            return s_PeriodTicks;
+        }
+        static void Interrupt() noexcept
+        {
+            if (HW::Registers::SR().UIF())
+            {
+                HW::Registers::SR().Acknowledge(TIM_SR_UIF);
+                Callback::Run();
+            }
+        }
+
+    private:
+        using tProperties::s_Peripheral
+            , tProperties::s_Priority
+            , tProperties::s_Prescaler
+            , tProperties::s_Reload
+            , tProperties::s_PeriodTicks;
+
+        using Properties = tProperties;
+        using Callback = Common::CallbackFor<tCallback, tProperties>;
+        using HW = HardwareKernal<Common::Tools::EnumValue(s_Peripheral)>;
+
+        using clk_t = CLK::Kernal<ClockID<s_Peripheral>()>;
+        using isr_t = ISR::Kernal<Module, InterruptSource<s_Peripheral>(), s_Priority>;
+
+    private:
+        clk_t const m_clk{};
+        isr_t const m_isr{};
+    };
+
+    template <typename CFG, typename CB>
+    Module(CFG, CB) -> Module<CFG, CB>;
+
+    // Paces another peripheral: every update event pulses TRGO and no interrupt is taken
+    template <typename tProperties>
+    class TriggerOutput : private tProperties
+    {
+    public:
+        TriggerOutput() noexcept
+        {
+            HW::Configure(CountDirection::Up, ClockDivision::Div1);
+            HW::SetPeriod(s_Prescaler, s_Reload);
+
+            HW::Registers::CR1().ARPE() = true;
+            HW::Registers::CR2().MMS() = Common::Tools::EnumValue(MasterMode::Update);
+        }
+        ~TriggerOutput()
+        {
+            HW::Disable();
+        }
+
+        static void Start() noexcept
+        {
+            HW::Registers::CNT() = 0u;
+            HW::Enable();
+        }
+        static void Stop() noexcept
+        {
+            HW::Disable();
+        }
+
+    private:
+        using tProperties::s_Peripheral
+            , tProperties::s_Prescaler
+            , tProperties::s_Reload;
+
+        using HW = HardwareKernal<Common::Tools::EnumValue(s_Peripheral)>;
+        using clk_t = CLK::Kernal<ClockID<s_Peripheral>()>;
+
+    private:
+        clk_t const m_clk{};
+    };
+}
\ No newline at end of file
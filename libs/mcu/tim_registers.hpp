@@ -0,0 +1,326 @@
+#pragma once
+
+#include "common/tools.hpp"
+#include "common/register.hpp"
+
+#include "macros.h"
+#include "stm32f103xb.h"
+#include "stm32f1xx.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace MCU::TIM
+{
+    inline namespace Settings
+    {
+        enum class CountDirection : bool
+        {
+            Up = false,
+            Down = true
+        };
+        enum class ClockDivision : uint8_t
+        {
+            Div1 = 0b00,
+            Div2 = 0b01,
+            Div4 = 0b10
+        };
+        enum class CapturePolarity : bool
+        {
+            Rising = false,
+            Falling = true
+        };
+        // What drives TRGO for the peripherals a timer paces
+        enum class MasterMode : uint8_t
+        {
+            Reset = 0b000,
+            Enable = 0b001,
+            Update = 0b010
+        };
+    }
+
+    namespace
+    {
+        using namespace Common::Tools;
+
+        // Control register 1
+        template <uint32_t tAddress>
+        struct CR1 : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto CEN() { return reg_t::template CreateBitfield<TIM_CR1_CEN>(); } // Counter enable
+            auto UDIS() { return reg_t::template CreateBitfield<TIM_CR1_UDIS>(); } // Update disable
+            auto URS() { return reg_t::template CreateBitfield<TIM_CR1_URS>(); } // Update request source
+            auto OPM() { return reg_t::template CreateBitfield<TIM_CR1_OPM>(); } // One pulse mode
+            auto DIR() { return reg_t::template CreateBitfield<TIM_CR1_DIR>(); } // Direction
+            auto CMS() { return reg_t::template CreateBitfield<TIM_CR1_CMS>(); } // Center-aligned mode selection
+            auto ARPE() { return reg_t::template CreateBitfield<TIM_CR1_ARPE>(); } // Auto-reload preload enable
+            auto CKD() { return reg_t::template CreateBitfield<TIM_CR1_CKD>(); } // Clock division
+        };
+
+        // Control register 2
+        template <uint32_t tAddress>
+        struct CR2 : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto MMS() { return reg_t::template CreateBitfield<TIM_CR2_MMS>(); } // Master mode selection
+        };
+
+        // DMA/Interrupt enable register
+        template <uint32_t tAddress>
+        struct DIER : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto UIE() { return reg_t::template CreateBitfield<TIM_DIER_UIE>(); } // Update interrupt enable
+            auto CC1IE() { return reg_t::template CreateBitfield<TIM_DIER_CC1IE>(); } // Capture/Compare 1 interrupt enable
+            auto CC2IE() { return reg_t::template CreateBitfield<TIM_DIER_CC2IE>(); } // Capture/Compare 2 interrupt enable
+            auto CC3IE() { return reg_t::template CreateBitfield<TIM_DIER_CC3IE>(); } // Capture/Compare 3 interrupt enable
+            auto CC4IE() { return reg_t::template CreateBitfield<TIM_DIER_CC4IE>(); } // Capture/Compare 4 interrupt enable
+            auto UDE() { return reg_t::template CreateBitfield<TIM_DIER_UDE>(); } // Update DMA request enable
+        };
+
+        // Status register
+        template <uint32_t tAddress>
+        struct SR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto UIF() { return reg_t::template CreateBitfield<TIM_SR_UIF>(); } // Update interrupt flag
+            auto CC1IF() { return reg_t::template CreateBitfield<TIM_SR_CC1IF>(); } // Capture/Compare 1 interrupt flag
+            auto CC2IF() { return reg_t::template CreateBitfield<TIM_SR_CC2IF>(); } // Capture/Compare 2 interrupt flag
+            auto CC3IF() { return reg_t::template CreateBitfield<TIM_SR_CC3IF>(); } // Capture/Compare 3 interrupt flag
+            auto CC4IF() { return reg_t::template CreateBitfield<TIM_SR_CC4IF>(); } // Capture/Compare 4 interrupt flag
+
+            // Flags are rc_w0, writing ones to every other flag leaves them untouched
+            ALWAYS_INLINE
+            void Acknowledge(uint32_t const flags) noexcept
+            {
+                reg_t::Write(~flags);
+            }
+        };
+
+        // Event generation register
+        template <uint32_t tAddress>
+        struct EGR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto UG() { return reg_t::template CreateBitfield<TIM_EGR_UG>(); } // Update generation
+        };
+
+        // Capture/compare mode register 1, input capture layout
+        template <uint32_t tAddress>
+        struct CCMR1 : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto CC1S() { return reg_t::template CreateBitfield<TIM_CCMR1_CC1S>(); } // Capture/Compare 1 selection
+            auto IC1F() { return reg_t::template CreateBitfield<TIM_CCMR1_IC1F>(); } // Input capture 1 filter
+            auto CC2S() { return reg_t::template CreateBitfield<TIM_CCMR1_CC2S>(); } // Capture/Compare 2 selection
+            auto IC2F() { return reg_t::template CreateBitfield<TIM_CCMR1_IC2F>(); } // Input capture 2 filter
+        };
+
+        // Capture/compare mode register 2, input capture layout
+        template <uint32_t tAddress>
+        struct CCMR2 : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto CC3S() { return reg_t::template CreateBitfield<TIM_CCMR2_CC3S>(); } // Capture/Compare 3 selection
+            auto IC3F() { return reg_t::template CreateBitfield<TIM_CCMR2_IC3F>(); } // Input capture 3 filter
+            auto CC4S() { return reg_t::template CreateBitfield<TIM_CCMR2_CC4S>(); } // Capture/Compare 4 selection
+            auto IC4F() { return reg_t::template CreateBitfield<TIM_CCMR2_IC4F>(); } // Input capture 4 filter
+        };
+
+        // Capture/compare enable register
+        template <uint32_t tAddress>
+        struct CCER : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+
+            auto CC1E() { return reg_t::template CreateBitfield<TIM_CCER_CC1E>(); } // Capture/Compare 1 enable
+            auto CC1P() { return reg_t::template CreateBitfield<TIM_CCER_CC1P>(); } // Capture/Compare 1 polarity
+            auto CC2E() { return reg_t::template CreateBitfield<TIM_CCER_CC2E>(); } // Capture/Compare 2 enable
+            auto CC2P() { return reg_t::template CreateBitfield<TIM_CCER_CC2P>(); } // Capture/Compare 2 polarity
+            auto CC3E() { return reg_t::template CreateBitfield<TIM_CCER_CC3E>(); } // Capture/Compare 3 enable
+            auto CC3P() { return reg_t::template CreateBitfield<TIM_CCER_CC3P>(); } // Capture/Compare 3 polarity
+            auto CC4E() { return reg_t::template CreateBitfield<TIM_CCER_CC4E>(); } // Capture/Compare 4 enable
+            auto CC4P() { return reg_t::template CreateBitfield<TIM_CCER_CC4P>(); } // Capture/Compare 4 polarity
+        };
+
+        // Capture/compare register 1-4
+        template <uint32_t tAddress>
+        struct CCR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+            using reg_t::operator=;
+        };
+
+        // Counter
+        template <uint32_t tAddress>
+        struct CNT : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+            using reg_t::operator=;
+        };
+
+        // Prescaler
+        template <uint32_t tAddress>
+        struct PSC : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+            using reg_t::operator=;
+        };
+
+        // Auto-reload register
+        template <uint32_t tAddress>
+        struct ARR : public u32_reg_t<tAddress>
+        {
+            using reg_t = u32_reg_t<tAddress>;
+            using reg_t::reg_t;
+            using reg_t::operator=;
+        };
+    }
+
+    template <unsigned tPeripheral>
+    class HardwareKernal
+    {
+    private:
+        static constexpr uint32_t BaseAddress() noexcept
+        {
+            if constexpr (tPeripheral == 1u) { return TIM1_BASE; }
+            if constexpr (tPeripheral == 2u) { return TIM2_BASE; }
+            if constexpr (tPeripheral == 3u) { return TIM3_BASE; }
+            if constexpr (tPeripheral == 4u) { return TIM4_BASE; }
+        }
+
+        using CR1_t = CR1<BaseAddress() + offsetof(TIM_TypeDef, CR1)>;
+        using CR2_t = CR2<BaseAddress() + offsetof(TIM_TypeDef, CR2)>;
+        using DIER_t = DIER<BaseAddress() + offsetof(TIM_TypeDef, DIER)>;
+        using SR_t = SR<BaseAddress() + offsetof(TIM_TypeDef, SR)>;
+        using EGR_t = EGR<BaseAddress() + offsetof(TIM_TypeDef, EGR)>;
+        using CNT_t = CNT<BaseAddress() + offsetof(TIM_TypeDef, CNT)>;
+        using PSC_t = PSC<BaseAddress() + offsetof(TIM_TypeDef, PSC)>;
+        using ARR_t = ARR<BaseAddress() + offsetof(TIM_TypeDef, ARR)>;
+        using CCMR1_t = CCMR1<BaseAddress() + offsetof(TIM_TypeDef, CCMR1)>;
+        using CCMR2_t = CCMR2<BaseAddress() + offsetof(TIM_TypeDef, CCMR2)>;
+        using CCER_t = CCER<BaseAddress() + offsetof(TIM_TypeDef, CCER)>;
+
+        template <unsigned tChannel>
+        static constexpr uint32_t CaptureAddress() noexcept
+        {
+            if constexpr (tChannel == 1u) { return BaseAddress() + offsetof(TIM_TypeDef, CCR1); }
+            if constexpr (tChannel == 2u) { return BaseAddress() + offsetof(TIM_TypeDef, CCR2); }
+            if constexpr (tChannel == 3u) { return BaseAddress() + offsetof(TIM_TypeDef, CCR3); }
+            if constexpr (tChannel == 4u) { return BaseAddress() + offsetof(TIM_TypeDef, CCR4); }
+        }
+
+        ALWAYS_INLINE
+        static auto Field(CountDirection const input) noexcept
+        {
+            return Registers::CR1().DIR().Value(EnumValue(input));
+        }
+        ALWAYS_INLINE
+        static auto Field(ClockDivision const input) noexcept
+        {
+            return Registers::CR1().CKD().Value(EnumValue(input));
+        }
+
+    public:
+        using type = HardwareKernal<tPeripheral>;
+
+        struct Registers
+        {
+            static CR1_t CR1() { return {}; }
+            static CR2_t CR2() { return {}; }
+            static DIER_t DIER() { return {}; }
+            static SR_t SR() { return {}; }
+            static EGR_t EGR() { return {}; }
+            static CNT_t CNT() { return {}; }
+            static PSC_t PSC() { return {}; }
+            static ARR_t ARR() { return {}; }
+            static CCMR1_t CCMR1() { return {}; }
+            static CCMR2_t CCMR2() { return {}; }
+            static CCER_t CCER() { return {}; }
+            template <unsigned tChannel>
+            static CCR<CaptureAddress<tChannel>()> CCR() { return {}; }
+        };
+
+        template <typename... tArgs>
+        static void Configure(tArgs... args) noexcept
+        {
+            Common::WriteFields(Field(args)...);
+        }
+        ALWAYS_INLINE
+        static void SetPeriod(uint32_t const prescaler, uint32_t const reload) noexcept
+        {
+            Registers::PSC() = prescaler;
+            Registers::ARR() = reload;
+            Registers::EGR().UG() = true; // Latch the shadow registers before the counter starts
+            Registers::SR().Acknowledge(TIM_SR_UIF);
+        }
+        ALWAYS_INLINE
+        static void Enable() noexcept
+        {
+            if (!Registers::CR1().CEN().Read()) { Registers::CR1().CEN() = true; }
+        }
+        ALWAYS_INLINE
+        static void Disable() noexcept
+        {
+            if (Registers::CR1().CEN().Read()) { Registers::CR1().CEN() = false; }
+        }
+        ALWAYS_INLINE
+        static uint32_t Counter() noexcept
+        {
+            return Registers::CNT().Read();
+        }
+
+        // Channel samples its own TIx input, 'filter' is the IC filter code (0 = none)
+        template <unsigned tChannel>
+        static void ConfigureCapture(CapturePolarity const polarity, uint8_t const filter) noexcept
+        {
+            static_assert((tChannel >= 1u) && (tChannel <= 4u), "Timers have capture channels 1-4.");
+
+            constexpr uint32_t DirectInput = 0b01;
+
+            if constexpr (tChannel == 1u) { Registers::CCER().CC1E() = false; Registers::CCMR1().CC1S() = DirectInput; Registers::CCMR1().IC1F() = filter; Registers::CCER().CC1P() = EnumValue(polarity); Registers::CCER().CC1E() = true; }
+            if constexpr (tChannel == 2u) { Registers::CCER().CC2E() = false; Registers::CCMR1().CC2S() = DirectInput; Registers::CCMR1().IC2F() = filter; Registers::CCER().CC2P() = EnumValue(polarity); Registers::CCER().CC2E() = true; }
+            if constexpr (tChannel == 3u) { Registers::CCER().CC3E() = false; Registers::CCMR2().CC3S() = DirectInput; Registers::CCMR2().IC3F() = filter; Registers::CCER().CC3P() = EnumValue(polarity); Registers::CCER().CC3E() = true; }
+            if constexpr (tChannel == 4u) { Registers::CCER().CC4E() = false; Registers::CCMR2().CC4S() = DirectInput; Registers::CCMR2().IC4F() = filter; Registers::CCER().CC4P() = EnumValue(polarity); Registers::CCER().CC4E() = true; }
+        }
+        template <unsigned tChannel>
+        static constexpr uint32_t CaptureFlag() noexcept
+        {
+            return (TIM_SR_CC1IF << (tChannel - 1u));
+        }
+        template <unsigned tChannel>
+        ALWAYS_INLINE
+        static void CaptureInterrupt(bool const enable) noexcept
+        {
+            if constexpr (tChannel == 1u) { Registers::DIER().CC1IE() = enable; }
+            if constexpr (tChannel == 2u) { Registers::DIER().CC2IE() = enable; }
+            if constexpr (tChannel == 3u) { Registers::DIER().CC3IE() = enable; }
+            if constexpr (tChannel == 4u) { Registers::DIER().CC4IE() = enable; }
+        }
+        // Reading the capture register also clears its flag
+        template <unsigned tChannel>
+        ALWAYS_INLINE
+        static uint16_t Captured() noexcept
+        {
+            return static_cast<uint16_t>(Registers::template CCR<tChannel>().Read());
+        }
+    };
+}
\ No newline at end of file
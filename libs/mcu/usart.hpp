@@ -6,13 +6,20 @@
 #include "rcc.hpp"
 #include "gpio.hpp"
 #include "interrupt.hpp"
+#include "dma.hpp"
 #include "usart_registers.hpp"
 
-#include "common/static_lambda.hpp"
-#include "common/containers/ring_buffer.hpp"
+#include "common/atomic.hpp"
+#include "common/delegate.hpp"
+#include "common/containers/span.hpp"
+#include "common/containers/spsc_queue.hpp"
 
+#include "stm32f1xx.h"
+
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace MCU::USART 
 {
@@ -38,6 +45,20 @@ namespace MCU::USART
             if constexpr (tPeriph == Peripheral::USART_2) { return ISR::InterruptSource::eUSART2; }
             if constexpr (tPeriph == Peripheral::USART_3) { return ISR::InterruptSource::eUSART3; }
         }
+        template <Peripheral tPeriph>
+        constexpr auto TxChannel() noexcept
+        {
+            if constexpr (tPeriph == Peripheral::USART_1) { return DMA::Channel::CH_4; }
+            if constexpr (tPeriph == Peripheral::USART_2) { return DMA::Channel::CH_7; }
+            if constexpr (tPeriph == Peripheral::USART_3) { return DMA::Channel::CH_2; }
+        }
+        template <Peripheral tPeriph>
+        constexpr auto RxChannel() noexcept
+        {
+            if constexpr (tPeriph == Peripheral::USART_1) { return DMA::Channel::CH_5; }
+            if constexpr (tPeriph == Peripheral::USART_2) { return DMA::Channel::CH_6; }
+            if constexpr (tPeriph == Peripheral::USART_3) { return DMA::Channel::CH_3; }
+        }
     }
 
     template 
@@ -52,11 +73,25 @@ namespace MCU::USART
         , Parity tParity = Parity::None
         , StopBits tStopBits = StopBits::_1bit
         , FlowControl tFlow = FlowControl::None
+        , TransferMode tTxMode = TransferMode::Interrupt
+        , TransferMode tRxMode = TransferMode::Interrupt
+        , uint32_t tBaudTolerancePpm = 20000u
+        , typename tCtsPin = IO::NoPin
+        , typename tRtsPin = IO::NoPin
     >
     struct Properties
     {
+        static constexpr bool s_UsesCts = ((Common::Tools::EnumValue(tFlow) & Common::Tools::EnumValue(FlowControl::CTS)) != 0u);
+        static constexpr bool s_UsesRts = ((Common::Tools::EnumValue(tFlow) & Common::Tools::EnumValue(FlowControl::RTS)) != 0u);
+
+        // The hardware only raises RTS while a byte waits unread in DR, which never happens with a DMA receiver. There
+        // the pin is a plain output driven from the free space the receive side reports.
+        static constexpr bool s_SoftwareRts = s_UsesRts && (tRxMode == TransferMode::DMA);
+
         using tx_pin_t = tTxPin;
         using rx_pin_t = tRxPin;
+        using cts_pin_t = std::conditional_t<s_UsesCts, tCtsPin, IO::NoPin>;
+        using rts_pin_t = std::conditional_t<s_UsesRts, tRtsPin, IO::NoPin>;
 
         static constexpr auto s_Peripheral = tPeriph;
         static constexpr auto s_PeriphClockFreq = tPeriphClock;
@@ -66,67 +101,294 @@ namespace MCU::USART
         static constexpr auto s_Parity = tParity;
         static constexpr auto s_StopBits = tStopBits;
         static constexpr auto s_FlowControl = tFlow;
+        static constexpr auto s_HardwareFlow = s_SoftwareRts ? static_cast<FlowControl>(Common::Tools::EnumValue(tFlow) & ~Common::Tools::EnumValue(FlowControl::RTS)) : tFlow;
+        static constexpr auto s_TxMode = tTxMode;
+        static constexpr auto s_RxMode = tRxMode;
+
+        // The divisor is fixed at compile time, the rate the line actually runs at is exported for the host side
+        static constexpr uint32_t s_BaudDivisor = BaudDivisor(tPeriphClock, tBaudRate);
+        static constexpr uint32_t s_AchievedBaud = AchievedBaud(tPeriphClock, s_BaudDivisor);
+        static constexpr uint32_t s_BaudErrorPpm = BaudErrorPpm(tPeriphClock, tBaudRate);
+        static constexpr uint32_t s_BaudTolerancePpm = tBaudTolerancePpm;
+
+        static_assert(ValidBaudDivisor(s_BaudDivisor), "Baud rate is out of range for the peripheral clock.");
+        static_assert(s_BaudErrorPpm <= tBaudTolerancePpm, "Baud rate error exceeds the tolerance, change the rate or the bus clock.");
+        static_assert(!s_UsesCts || !std::is_same_v<tCtsPin, IO::NoPin>, "CTS flow control needs a CTS pin.");
+        static_assert(!s_UsesRts || !std::is_same_v<tRtsPin, IO::NoPin>, "RTS flow control needs an RTS pin.");
 
         constexpr Properties() noexcept = default;
 
+    private:
+        static constexpr auto RtsMode() noexcept
+        {
+            if constexpr (s_SoftwareRts) { return IO::Output::PushPull; }
+            else { return IO::Alternate::PushPull; }
+        }
+
     private:
         tx_pin_t const m_tx{ IO::Alternate::PushPull };
         rx_pin_t const m_rx{ IO::PullResistor::PullUp, IO::Input::PuPd };
+        cts_pin_t const m_cts{ IO::PullResistor::PullUp, IO::Input::PuPd }; // Idles high, the sender is held until the peer pulls it low
+        rts_pin_t const m_rts{ IO::State::Low, RtsMode() };                 // Low asks the peer to send
     };
 
-    template <Peripheral tPeriph, size_t BufferSize = 64u>
+    // Interrupt driven transmit: Write() copies into the queue and the TXE interrupt sends it a byte at a time. TXEIE
+    // is a single bit, it is set and cleared through the bit-band alias so neither side tears the other's CR1 bits.
+    template <Peripheral tPeriph, size_t tBufferSize = 64u>
     struct DataHandler
     {
-        using buffer_t = Common::Containers::RingBuffer<char, BufferSize>;
+        using buffer_t = Common::Containers::SpscQueue<char, tBufferSize>;
 
         using HW = HardwareKernal<Common::Tools::EnumValue(tPeriph)>;
 
-        inline static buffer_t s_rxBuffer{};
-        inline static Common::Containers::RingBuffer<char, 8> s_txBuffer{};
+        inline static buffer_t s_txBuffer{};
 
         ALWAYS_INLINE
         static void TransmitInternal() noexcept
         {
-            
-            if (!HW::Registers::CR1().TCIE())
+            if (auto data{ s_txBuffer.TryPop() }; data.has_value())
             {
-                HW::Registers::CR1().TCIE() = true;
+                HW::Registers::DR() = data.value();
             }
+            else { HW::Registers::CR1().TXEIE() = false; }
+        }
+        // Copies what fits behind the queued bytes, returns the count
+        static size_t Write(Common::Containers::Span<char const> data) noexcept
+        {
+            size_t const count{ s_txBuffer.Write(data) };
+            if (count != 0u) { HW::Registers::CR1().TXEIE() = true; }
+            return count;
+        }
+        // Queue empty and the last byte off the wire
+        static bool Idle() noexcept
+        {
+            return s_txBuffer.Empty() && HW::Registers::SR().TC();
+        }
+    };
+
+    // Zero-copy transmit: queued spans are handed to the DMA channel as they are and the next one is chained from the
+    // transfer complete interrupt. A span has to stay valid until Idle() or until a later span has started.
+    template <Peripheral tPeriph, size_t tQueueDepth = 8u, unsigned tPriority = 5u>
+    class TxStream
+    {
+    public:
+        using Chunk = Common::Containers::Span<char const>;
+
+        TxStream() noexcept
+        {
+            DMA_t::Stop();
+            DMA_t::Configure(DMA::Direction::ReadMemory, DMA::DataSize::_8bit, DMA::Increment::Memory, DMA::Circular::Off, DMA::Priority::Low);
+            DMA_t::SetPeripheral(HW::Registers::DR().GetAddress());
+            DMA_t::Acknowledge(DMA_t::Flags::Global);
+            DMA_t::Registers::CCR().TCIE() = true;
+            DMA_t::Registers::CCR().TEIE() = true;
+
+            HW::Registers::CR3().DMAT() = true;
+        }
+        ~TxStream() noexcept
+        {
+            DMA_t::Stop();
+            HW::Registers::CR3().DMAT() = false;
+        }
+
+        // Returns false and queues nothing when the queue is full, the caller decides whether to retry or drop
+        static bool Write(Chunk data) noexcept
+        {
+            if (data.empty()) { return true; }
 
-            if (auto data{ s_txBuffer.Pop() }; data.has_value())
+            Common::CriticalSection const lock{};
+
+            bool accepted{ true };
+            if (!s_busy)
             {
-                HW::Registers::DR() = data.value();
+                s_busy = true;
+                s_current = data;
+                Next();
             }
-            else {
-                HW::Registers::CR1().TCIE() = false;
+            else if (!s_queue.TryPush(data))
+            {
+                accepted = false;
+                ++s_rejected;
             }
+            s_queued = s_queued + uint32_t{ accepted };
+            return accepted;
         }
-        ALWAYS_INLINE
-        static void BlockingTransmit(char const input) noexcept
+        static bool Idle() noexcept
         {
-            while (!HW::Registers::SR().TC());
-            HW::Registers::DR() = input;
+            return !s_busy;
         }
-        ALWAYS_INLINE
-        static void PushTx(char const input) noexcept
+        // Chunks waiting behind the one in flight
+        static size_t Backlog() noexcept
         {
-            s_txBuffer.Push(input);
+            return s_queue.Size();
         }
-        ALWAYS_INLINE
-        static bool IsTerminator(char const input) noexcept
+        static size_t Capacity() noexcept
         {
-            switch (input)
+            return tQueueDepth;
+        }
+        static uint32_t Rejected() noexcept
+        {
+            return s_rejected;
+        }
+        // Running counts of accepted and completed chunks. A chunk accepted as number n may be reused once
+        // Sent() has reached n, both wrap together.
+        static uint32_t Queued() noexcept
+        {
+            return s_queued;
+        }
+        static uint32_t Sent() noexcept
+        {
+            return s_sent;
+        }
+        static uint32_t Errors() noexcept
+        {
+            return s_errors;
+        }
+        static void Interrupt() noexcept
+        {
+            if (DMA_t::Pending(DMA_t::Flags::TransferError)) { ++s_errors; }
+            DMA_t::Acknowledge(DMA_t::Flags::Global);
+            if (s_current.empty()) { s_sent = s_sent + 1u; }
+            Next();
+        }
+
+    private:
+        using HW = HardwareKernal<Common::Tools::EnumValue(tPeriph)>;
+        using DMA_t = DMA::HAL<TxChannel<tPeriph>()>;
+
+        using isr_t = ISR::Kernal<TxStream, DMA::InterruptSource<TxChannel<tPeriph>()>(), tPriority>;
+
+        // Spans longer than one transfer are sent in slices
+        static void Next() noexcept
+        {
+            if (s_current.empty())
             {
-                case '\r':
-                case '\n':
-                case ';': return true;
-                default: return false;
+                if (auto next{ s_queue.TryPop() }; next.has_value()) { s_current = next.value(); }
+                else
+                {
+                    DMA_t::Stop();
+                    s_busy = false;
+                    return;
+                }
             }
+
+            size_t const count{ (s_current.size() < DMA_t::MaxTransfer) ? s_current.size() : DMA_t::MaxTransfer };
+            DMA_t::Start(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(s_current.data())), count);
+            s_current = s_current.subspan(count);
         }
+
+    private:
+        inline static Common::Containers::SpscQueue<Chunk, tQueueDepth> s_queue{};
+        inline static Chunk s_current{};
+        inline static bool volatile s_busy{ false };
+        inline static uint32_t s_rejected{ 0 };
+        inline static uint32_t s_errors{ 0 };
+        inline static uint32_t volatile s_queued{ 0 };
+        inline static uint32_t volatile s_sent{ 0 };
+
+        DMA::clk_t const m_clk{};
+        isr_t const m_isr{};
+    };
+
+    struct ReceiveErrors
+    {
+        uint32_t Overrun{ 0 };
+        uint32_t Framing{ 0 };
+        uint32_t Noise{ 0 };
     };
 
+    // The DMA channel fills a circular buffer continuously. Whatever arrived since the last hand-over is passed to
+    // tSink::Run() as spans into that buffer when the line goes idle and at the half and full marks, so a frame longer
+    // than half the buffer arrives in pieces. Spans are only valid for the duration of the call.
+    template <Peripheral tPeriph, typename tSink, size_t tBufferSize = 128u, unsigned tPriority = 5u>
+    class RxStream
+    {
+    public:
+        using Frame = Common::Containers::Span<char const>;
+
+        static_assert(tBufferSize <= DMA::HAL<RxChannel<tPeriph>()>::MaxTransfer, "Receive buffer is larger than one DMA transfer.");
+
+        RxStream() noexcept
+        {
+            DMA_t::Stop();
+            DMA_t::Configure(DMA::Direction::ReadPeripheral, DMA::DataSize::_8bit, DMA::Increment::Memory, DMA::Circular::On, DMA::Priority::Medium);
+            DMA_t::SetPeripheral(HW::Registers::DR().GetAddress());
+            DMA_t::Acknowledge(DMA_t::Flags::Global);
+            DMA_t::Registers::CCR().HTIE() = true;
+            DMA_t::Registers::CCR().TCIE() = true;
+
+            s_tail = 0u;
+            DMA_t::Start(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(s_buffer.data())), tBufferSize);
+
+            HW::Registers::CR3().DMAR() = true;
+        }
+        ~RxStream() noexcept
+        {
+            HW::Registers::CR3().DMAR() = false;
+            DMA_t::Stop();
+        }
+
+        // SR then DR read clears IDLE and the error flags, the DMA has already taken the data byte
+        static void LineEvent(uint32_t const status) noexcept
+        {
+            (void)HW::Registers::DR().Read();
+
+            s_errors.Overrun += ((status & USART_SR_ORE) != 0u) ? 1u : 0u;
+            s_errors.Framing += ((status & USART_SR_FE) != 0u) ? 1u : 0u;
+            s_errors.Noise += ((status & USART_SR_NE) != 0u) ? 1u : 0u;
+
+            if ((status & USART_SR_IDLE) != 0u) { Deliver(); }
+        }
+        static ReceiveErrors Errors() noexcept
+        {
+            return s_errors;
+        }
+        static void Interrupt() noexcept
+        {
+            DMA_t::Acknowledge(DMA_t::Flags::Global);
+            Deliver();
+        }
+
+    private:
+        using HW = HardwareKernal<Common::Tools::EnumValue(tPeriph)>;
+        using DMA_t = DMA::HAL<RxChannel<tPeriph>()>;
+
+        using isr_t = ISR::Kernal<RxStream, DMA::InterruptSource<RxChannel<tPeriph>()>(), tPriority>;
+
+        // The USART and the DMA interrupt share a priority, so this never runs twice at once
+        static void Deliver() noexcept
+        {
+            size_t head{ tBufferSize - DMA_t::Remaining() };
+            if (head == tBufferSize) { head = 0u; }
+            if (head == s_tail) { return; }
+
+            if (head > s_tail)
+            {
+                tSink::Run(Frame{ s_buffer.data() + s_tail, head - s_tail });
+            }
+            else
+            {
+                tSink::Run(Frame{ s_buffer.data() + s_tail, tBufferSize - s_tail });
+                if (head != 0u) { tSink::Run(Frame{ s_buffer.data(), head }); }
+            }
+            s_tail = head;
+        }
+
+    private:
+        inline static std::array<char, tBufferSize> s_buffer{};
+        inline static size_t s_tail{ 0 };
+        inline static ReceiveErrors s_errors{};
+
+        DMA::clk_t const m_clk{};
+        isr_t const m_isr{};
+    };
+
+    // Stand in for the DMA streams when the module works byte by byte
+    struct NoStream {};
+    struct NoReceiver {};
+
     template <typename tProperties, typename tCallback>
-    class Module : private tProperties, Common::StaticLambda<tCallback>
+    class Module : private tProperties, Common::CallbackFor<tCallback, tProperties>
     {
     public:
         template <typename C>
@@ -134,11 +396,17 @@ namespace MCU::USART
             : Properties{}
             , Callback{ std::forward<C>(callback) }
         {
-            HW::SetBaudRate(s_PeriphClockFreq, s_BaudRate);
+            HW::SetBaudDivisor(s_BaudDivisor);
             
-            HW::Configure(s_DataDirection, s_DataWidth, s_Parity, s_StopBits, s_FlowControl);
+            HW::Configure(s_DataDirection, s_DataWidth, s_Parity, s_StopBits, s_HardwareFlow);
+            HW::Registers::CR3().CTSIE() = s_UsesCts;
 
-            HW::Registers::CR1().RXNEIE() = true;
+            if constexpr (s_RxMode == TransferMode::DMA)
+            {
+                HW::Registers::CR1().IDLEIE() = true;
+                HW::Registers::CR3().EIE() = true;
+            }
+            else { HW::Registers::CR1().RXNEIE() = true; }
 
             HW::Enable();
         }
@@ -149,30 +417,124 @@ namespace MCU::USART
         {
             HW::Disable();
         }
+
+        // DMA mode returns false when the data does not fit behind what is already queued. Interrupt mode copies the
+        // data into its short queue piece by piece, waiting for room, so it must not be called with interrupts masked.
+        static bool Write(Common::Containers::Span<char const> data) noexcept
+        {
+            if constexpr (s_TxMode == TransferMode::DMA) { return Stream::Write(data); }
+            else
+            {
+                while (!data.empty()) { data = data.subspan(Data::Write(data)); }
+                return true;
+            }
+        }
+        // Nothing queued or in flight, buffers handed to Write() may be reused
+        static bool Idle() noexcept
+        {
+            if constexpr (s_TxMode == TransferMode::DMA) { return Stream::Idle(); }
+            else { return Data::Idle(); }
+        }
+        // Rate the line actually runs at after divisor rounding
+        static uint32_t BaudRate() noexcept
+        {
+            return s_baudRate;
+        }
+        static constexpr uint32_t FastestBaudRate() noexcept
+        {
+            return FastestBaud(s_PeriphClockFreq, s_BaudTolerancePpm);
+        }
+        // Lets queued output drain at the old rate, then reprograms the divisor with the USART stopped.
+        // Returns false and keeps the current rate when the clock cannot reach 'baud_rate' within the tolerance.
+        static bool SetBaudRate(uint32_t const baud_rate) noexcept
+        {
+            if (!BaudReachable(s_PeriphClockFreq, baud_rate, s_BaudTolerancePpm)) { return false; }
+
+            uint32_t const divisor{ BaudDivisor(s_PeriphClockFreq, baud_rate) };
+
+            while (!Idle()) {}
+            while (!HW::Registers::SR().TC()) {}
+
+            HW::Disable();
+            HW::SetBaudDivisor(divisor);
+            HW::Enable();
+
+            s_baudRate = AchievedBaud(s_PeriphClockFreq, divisor);
+            return true;
+        }
+        // Chunk counters of the DMA queue, see TxStream. Interrupt mode copies on Write so both stay at zero.
+        static uint32_t Queued() noexcept
+        {
+            if constexpr (s_TxMode == TransferMode::DMA) { return Stream::Queued(); }
+            else { return 0u; }
+        }
+        static uint32_t Sent() noexcept
+        {
+            if constexpr (s_TxMode == TransferMode::DMA) { return Stream::Sent(); }
+            else { return 0u; }
+        }
         
+        static ReceiveErrors Errors() noexcept
+        {
+            if constexpr (s_RxMode == TransferMode::DMA) { return Receiver::Errors(); }
+            else { return {}; }
+        }
+        // Receive back-pressure. Hold() raises RTS so the peer pauses after the byte or two it has in flight, the
+        // receive interrupt holds by itself when the sink reports it is out of room. Without software RTS both do
+        // nothing and the USART paces the peer itself.
+        static void Hold() noexcept
+        {
+            if constexpr (s_SoftwareRts) { rts_pin_t::Write(IO::State::High); s_held = true; }
+        }
+        static void Resume() noexcept
+        {
+            if constexpr (s_SoftwareRts) { s_held = false; rts_pin_t::Write(IO::State::Low); }
+        }
+        static bool Held() noexcept
+        {
+            return s_held;
+        }
+        // Transmission is paused by the hardware while the peer holds CTS high
+        static bool ClearToSend() noexcept
+        {
+            if constexpr (s_UsesCts) { return !cts_pin_t::Read(); }
+            else { return true; }
+        }
+        // CTS edges seen, each one a pause or a resume from the peer
+        static uint32_t CtsChanges() noexcept
+        {
+            return s_ctsChanges;
+        }
         static void Interrupt() noexcept
         {
-            if (HW::Registers::SR().RXNE())
+            if constexpr (s_UsesCts)
             {
-                char const c = HW::Registers::DR().Read();
-                if (!Data::IsTerminator(c))
+                if (HW::Registers::SR().CTS())
                 {
-                    Data::PushTx(c);
-                    if constexpr (0)
-                    {
-                        Data::BlockingTransmit(c);
-                    }
+                    HW::Registers::SR().Acknowledge(USART_SR_CTS);
+                    s_ctsChanges = s_ctsChanges + 1u;
                 }
-                else {
-                    //data_t::BlockingSendBuffer(data_t::m_txBuffer);
-                    Callback::Run(true);
-                    Data::TransmitInternal();
-                    Data::s_rxBuffer.Clear();
+            }
+
+            uint32_t const status{ HW::Registers::SR().Read() };
+
+            if constexpr (s_RxMode == TransferMode::DMA)
+            {
+                if ((status & (USART_SR_IDLE | USART_SR_ORE | USART_SR_FE | USART_SR_NE)) != 0u)
+                {
+                    Receiver::LineEvent(status);
                 }
             }
-            else if (HW::Registers::SR().TC())
+            else if ((status & USART_SR_RXNE) != 0u)
+            {
+                // Handed on as it arrives, the sink assembles lines the same way it does from the DMA
+                char const c{ static_cast<char>(HW::Registers::DR().Read()) };
+                Sink::Run(Common::Containers::Span<char const>{ &c, 1u });
+            }
+
+            if constexpr (s_TxMode != TransferMode::DMA)
             {
-                Data::TransmitInternal();
+                if (((status & USART_SR_TXE) != 0u) && HW::Registers::CR1().TXEIE()) { Data::TransmitInternal(); }
             }
         }
 
@@ -180,24 +542,55 @@ namespace MCU::USART
         using tProperties::s_Peripheral
             , tProperties::s_PeriphClockFreq
             , tProperties::s_BaudRate
+            , tProperties::s_BaudDivisor
+            , tProperties::s_AchievedBaud
+            , tProperties::s_BaudTolerancePpm
             , tProperties::s_DataDirection
             , tProperties::s_DataWidth
             , tProperties::s_Parity
             , tProperties::s_StopBits
-            , tProperties::s_FlowControl;
+            , tProperties::s_FlowControl
+            , tProperties::s_HardwareFlow
+            , tProperties::s_UsesCts
+            , tProperties::s_SoftwareRts
+            , tProperties::s_TxMode
+            , tProperties::s_RxMode;
         
         using Data = DataHandler<s_Peripheral>;
         using Properties = tProperties;
-        using Callback = Common::StaticLambda<tCallback>;
+        using cts_pin_t = typename tProperties::cts_pin_t;
+        using rts_pin_t = typename tProperties::rts_pin_t;
+        using Callback = Common::CallbackFor<tCallback, tProperties>;
         using HW = HardwareKernal<Common::Tools::EnumValue(s_Peripheral)>;
         
         using clk_t = CLK::Kernal<ClockID<s_Peripheral>()>;
         using isr_t = ISR::Kernal<Module, InterruptSource<s_Peripheral>()>;
-        
+
+        using Stream = std::conditional_t<(s_TxMode == TransferMode::DMA), TxStream<s_Peripheral>, NoStream>;
+        // A sink returning bool reports whether it has room for more, false raises RTS until Resume()
+        struct Sink
+        {
+            static void Run(Common::Containers::Span<char const> frame) noexcept
+            {
+                if constexpr (std::is_same_v<decltype(Callback::Run(frame)), bool>)
+                {
+                    if (!Callback::Run(frame)) { Hold(); }
+                }
+                else { Callback::Run(frame); }
+            }
+        };
+
+        using Receiver = std::conditional_t<(s_RxMode == TransferMode::DMA), RxStream<s_Peripheral, Sink>, NoReceiver>;
+
+        inline static uint32_t s_baudRate{ s_AchievedBaud };
+        inline static bool volatile s_held{ false };
+        inline static uint32_t volatile s_ctsChanges{ 0 };
 
     private:
         clk_t const m_clk{};
         isr_t const m_isr{};
+        [[no_unique_address]] Stream const m_stream{};
+        [[no_unique_address]] Receiver const m_receiver{};
     };
 
     template <typename CFG, typename CB>
@@ -44,6 +44,11 @@ namespace MCU::USART
             RTS = 0b10,
             CTS_RTS = CTS | RTS
         };
+        enum class TransferMode : uint8_t
+        {
+            Interrupt = 0,  // One TC interrupt per byte out of the driver's ring buffer
+            DMA             // Caller's buffers are streamed by the DMA channel, one interrupt per chunk
+        };
     }
 
     namespace
@@ -67,6 +72,12 @@ namespace MCU::USART
             auto NE() { return reg_t::template CreateBitfield<USART_SR_NE>(); } // Noise error
             auto FE() { return reg_t::template CreateBitfield<USART_SR_FE>(); } // Framing error
             auto PE() { return reg_t::template CreateBitfield<USART_SR_PE>(); } // Parity error
+
+            // CTS, LBD, TC and RXNE clear on writing 0, writing 1 leaves them alone
+            void Acknowledge(uint32_t const flags) noexcept
+            {
+                reg_t::Write(~flags);
+            }
         };
 
         // Data register
@@ -93,6 +104,7 @@ namespace MCU::USART
         {
             using reg_t = u32_reg_t<tAddress>;
             using reg_t::reg_t;
+            using reg_t::operator=;
    
             auto DIV_Mantissa() { return reg_t::template CreateBitfield<USART_BRR_DIV_Mantissa>(); } // Mantissa of USARTDIV
             auto DIV_Fraction() { return reg_t::template CreateBitfield<USART_BRR_DIV_Fraction>(); } // Fraction of USARTDIV
@@ -114,6 +126,7 @@ namespace MCU::USART
             auto TXEIE() { return reg_t::template CreateBitfield<USART_CR1_TXEIE>(); } // TXE interrupt enable        
             auto TCIE() { return reg_t::template CreateBitfield<USART_CR1_TCIE>(); } // Transmission complete interrupt enable           
             auto RXNEIE() { return reg_t::template CreateBitfield<USART_CR1_RXNEIE>(); } // RXNE interrupt enable          
+            auto IDLEIE() { return reg_t::template CreateBitfield<USART_CR1_IDLEIE>(); } // IDLE interrupt enable
             auto TE() { return reg_t::template CreateBitfield<USART_CR1_TE>(); } // Transmitter enable            
             auto RE() { return reg_t::template CreateBitfield<USART_CR1_RE>(); } // Receiver enable         
             auto RWU() { return reg_t::template CreateBitfield<USART_CR1_RWU>(); } // Receiver wakeup           
@@ -183,6 +196,59 @@ namespace MCU::USART
         };
     }
 
+    // BRR holds USARTDIV in 12.4 fixed point, which is simply clock / baud rounded to the nearest integer
+    constexpr uint32_t BaudDivisor(uint32_t const periph_clock, uint32_t const baud_rate) noexcept
+    {
+        return ((periph_clock + (baud_rate / 2u)) / baud_rate);
+    }
+    constexpr uint32_t AchievedBaud(uint32_t const periph_clock, uint32_t const divisor) noexcept
+    {
+        return ((periph_clock + (divisor / 2u)) / divisor);
+    }
+    // Parts per million between the requested and the achieved rate
+    constexpr uint32_t BaudErrorPpm(uint32_t const periph_clock, uint32_t const baud_rate) noexcept
+    {
+        uint64_t const ideal{ uint64_t{ baud_rate } * BaudDivisor(periph_clock, baud_rate) };
+        uint64_t const difference{ (ideal > periph_clock) ? (ideal - periph_clock) : (periph_clock - ideal) };
+        return static_cast<uint32_t>((difference * 1000000u) / ideal);
+    }
+    constexpr bool ValidBaudDivisor(uint32_t const divisor) noexcept
+    {
+        return ((divisor >= 16u) && (divisor <= 0xFFFFu)); // USARTDIV of at least 1.0, 12 bit mantissa
+    }
+
+    constexpr bool BaudReachable(uint32_t const periph_clock, uint32_t const baud_rate, uint32_t const tolerance_ppm) noexcept
+    {
+        return (baud_rate != 0u)
+            && ValidBaudDivisor(BaudDivisor(periph_clock, baud_rate))
+            && (BaudErrorPpm(periph_clock, baud_rate) <= tolerance_ppm);
+    }
+
+    inline constexpr uint32_t StandardBaudRates[]
+    {
+        4500000u, 3000000u, 2000000u, 1000000u, 921600u, 460800u, 230400u, 115200u, 57600u, 38400u, 19200u, 9600u
+    };
+
+    // Highest standard rate the clock reaches within the tolerance, 0 when there is none
+    constexpr uint32_t FastestBaud(uint32_t const periph_clock, uint32_t const tolerance_ppm) noexcept
+    {
+        for (uint32_t const rate : StandardBaudRates)
+        {
+            if (BaudReachable(periph_clock, rate, tolerance_ppm)) { return rate; }
+        }
+        return 0u;
+    }
+    // Snaps a measured rate to the standard rate it is within 'tolerance_ppm' of, otherwise keeps the measurement
+    constexpr uint32_t NearestStandardBaud(uint32_t const measured, uint32_t const tolerance_ppm) noexcept
+    {
+        for (uint32_t const rate : StandardBaudRates)
+        {
+            uint64_t const difference{ (measured > rate) ? (measured - rate) : (rate - measured) };
+            if (((difference * 1000000u) / rate) <= tolerance_ppm) { return rate; }
+        }
+        return measured;
+    }
+
     template <unsigned tPeripheral>
     class HardwareKernal
     {
@@ -203,35 +269,32 @@ namespace MCU::USART
         using GTPR_t = GTPR<BaseAddress() + offsetof(USART_TypeDef, GTPR)>;
 
         ALWAYS_INLINE
-        static void Set(DataDirection const input) noexcept
+        static auto Field(DataDirection const input) noexcept
         {
             uint32_t tmp{ Common::Tools::EnumValue(input) };
-            Registers::CR1().TE() = (tmp & 0b01);
-            Registers::CR1().RE() = ((tmp >> 1u) & 0b01);
+            return Registers::CR1().TE().Value(tmp & 0b01) | Registers::CR1().RE().Value((tmp >> 1u) & 0b01);
         }
         ALWAYS_INLINE
-        static void Set(DataWidth const input) noexcept
+        static auto Field(DataWidth const input) noexcept
         {
-            Registers::CR1().M() = Common::Tools::EnumValue(input);
+            return Registers::CR1().M().Value(Common::Tools::EnumValue(input));
         }
         ALWAYS_INLINE
-        static void Set(Parity const input) noexcept
+        static auto Field(Parity const input) noexcept
         {
             uint32_t tmp{ Common::Tools::EnumValue(input) };
-            Registers::CR1().PCE() = (tmp & 0b01);
-            Registers::CR1().PS() = (tmp >> 1u) & 0b01;
+            return Registers::CR1().PCE().Value(tmp & 0b01) | Registers::CR1().PS().Value((tmp >> 1u) & 0b01);
         }
         ALWAYS_INLINE
-        static void Set(StopBits const input) noexcept
+        static auto Field(StopBits const input) noexcept
         {
-            Registers::CR2().STOP() = Common::Tools::EnumValue(input);
+            return Registers::CR2().STOP().Value(Common::Tools::EnumValue(input));
         }
         ALWAYS_INLINE
-        static void Set(FlowControl const input) noexcept
+        static auto Field(FlowControl const input) noexcept
         {
             uint32_t tmp{ Common::Tools::EnumValue(input) };
-            Registers::CR3().CTSE() = (tmp & 0b01);
-            Registers::CR3().RTSE() = ((tmp >> 1u) & 0b01);
+            return Registers::CR3().CTSE().Value(tmp & 0b01) | Registers::CR3().RTSE().Value((tmp >> 1u) & 0b01);
         }
     
     public:
@@ -247,10 +310,11 @@ namespace MCU::USART
             static CR3_t CR3() { return {}; }
             static GTPR_t GTPR() { return {}; }
         };
+        // One write per control register however many settings are given
         template <typename... tArgs>
         static void Configure(tArgs... args) noexcept
         {
-            ( Set(args), ... );
+            Common::WriteFields(Field(args)...);
         }
         ALWAYS_INLINE
         static void Enable() noexcept
@@ -265,12 +329,13 @@ namespace MCU::USART
         ALWAYS_INLINE
         static void SetBaudRate(uint32_t const periph_clock, uint32_t const baud_rate) noexcept
         {
-            uint32_t div_x100{ (periph_clock * 25u) / (4u * baud_rate) };
-            uint32_t div_mant{ div_x100 / 100u };
-            uint32_t div_frac{ (((div_x100 - (div_mant * 100u)) * 16u) + 50u) / 100u };
-
-            Registers::BRR().DIV_Mantissa() = (uint16_t)(div_mant & 0xFFF);
-            Registers::BRR().DIV_Fraction() = (uint16_t)(div_frac & 0xF);
+            SetBaudDivisor(BaudDivisor(periph_clock, baud_rate));
+        }
+        // Mantissa and fraction in one store
+        ALWAYS_INLINE
+        static void SetBaudDivisor(uint32_t const divisor) noexcept
+        {
+            Registers::BRR() = (divisor & (USART_BRR_DIV_Mantissa | USART_BRR_DIV_Fraction));
         }
         template <typename T>
             requires std::same_as<T, Settings::DataDirection>
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "printf/printf.h"
+
+#include "common/containers/span.hpp"
+
+#include <array>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace Printf
+{
+    // fctprintf sink that formats into lines and hands each finished line to the transmitter as one chunk, so printf
+    // costs a buffer store per character and one queue operation per line. Lines go out zero-copy on a DMA link and
+    // are reused once the transmitter has counted them sent. Every context that prints (main loop, each interrupt
+    // priority) needs its own instance.
+    //
+    // With every line still queued the writer waits up to tWaitCycles of tClock for one to leave, then drops the
+    // line it is formatting and counts it.
+    template <typename tSerial, typename tClock, uint32_t tWaitCycles, size_t tLineSize = 96u, size_t tLines = 4u>
+    class LineOutput
+    {
+    public:
+        static_assert((tLines & (tLines - 1u)) == 0u, "Line count must be a power of two.");
+
+        ATTR_PRINTF(2, 3)
+        int Print(char const * const format, ...) noexcept
+        {
+            va_list args;
+            va_start(args, format);
+            int const count{ vfctprintf(&LineOutput::Out, this, format, args) };
+            va_end(args);
+            return count;
+        }
+        int VPrint(char const * const format, va_list args) noexcept
+        {
+            return vfctprintf(&LineOutput::Out, this, format, args);
+        }
+        void Put(char const c) noexcept
+        {
+            if ((m_fill == 0u) && !Claim())
+            {
+                m_discard = true;
+                ++m_dropped;
+            }
+
+            if (!m_discard) { m_lines[m_next & Mask][m_fill] = c; }
+            m_fill = m_fill + 1u;
+
+            if ((c == '\n') || (m_fill == tLineSize)) { Flush(); }
+        }
+        // A line ends at '\n' or when full, this sends a partial one
+        void Flush() noexcept
+        {
+            if (m_fill == 0u) { return; }
+
+            if (!m_discard)
+            {
+                Line const & line{ m_lines[m_next & Mask] };
+                Chunk const chunk{ line.data(), m_fill };
+
+                bool sent{ tSerial::Write(chunk) };
+                for (uint32_t const start{ tClock::Now() }; !sent && ((tClock::Now() - start) < tWaitCycles); ) { sent = tSerial::Write(chunk); }
+
+                if (sent)
+                {
+                    m_tickets[m_next & Mask] = tSerial::Queued();
+                    m_next = m_next + 1u;
+                }
+                else { ++m_dropped; }
+            }
+            m_fill = 0u;
+            m_discard = false;
+        }
+        [[nodiscard]]
+        uint32_t Dropped() const noexcept
+        {
+            return m_dropped;
+        }
+
+        // fctprintf callback, 'context' is the LineOutput
+        static void Out(char const c, void * const context) noexcept
+        {
+            static_cast<LineOutput *>(context)->Put(c);
+        }
+
+    private:
+        using Line = std::array<char, tLineSize>;
+        using Chunk = Common::Containers::Span<char const>;
+
+        static constexpr uint32_t Mask = tLines - 1u;
+
+        // The line about to be filled was queued tLines lines ago, it is free once the transmitter has sent it
+        bool Claim() noexcept
+        {
+            uint32_t const ticket{ m_tickets[m_next & Mask] };
+            if (Sent(ticket)) { return true; }
+
+            uint32_t const start{ tClock::Now() };
+            while ((tClock::Now() - start) < tWaitCycles)
+            {
+                if (Sent(ticket)) { return true; }
+            }
+            return false;
+        }
+        static bool Sent(uint32_t const ticket) noexcept
+        {
+            return (static_cast<int32_t>(tSerial::Sent() - ticket) >= 0);
+        }
+
+    private:
+        std::array<Line, tLines> m_lines{};
+        std::array<uint32_t, tLines> m_tickets{};
+        uint32_t m_next{ 0 };
+        size_t m_fill{ 0 };
+        bool m_discard{ false };
+        uint32_t m_dropped{ 0 };
+    };
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Brings the serial link up to the fastest rate the device clock and the cable manage.
+
+The device acknowledges a rate change at the old rate, switches once that reply
+has left and falls back unless a clean command arrives at the new rate within
+two seconds. Rates are tried fastest first until *IDN? answers.
+
+    link.py /dev/ttyUSB0                     negotiate from 19200
+    link.py /dev/ttyUSB0 --rate 57600        switch to one rate
+    link.py /dev/ttyUSB0 --auto 57600        device measures a 0x55 sync byte sent at 57600
+
+Needs pyserial.
+"""
+
+import argparse
+import sys
+import time
+
+import serial
+
+STANDARD_RATES = [4500000, 3000000, 2000000, 1000000, 921600, 460800, 230400, 115200, 57600, 38400, 19200, 9600]
+CONFIRM_TIME = 2.0
+
+
+def command(port, text, timeout=0.5):
+    port.reset_input_buffer()
+    port.write(text.encode("ascii") + b"\r\n")
+    port.timeout = timeout
+    return port.readline().decode("ascii", "replace").strip()
+
+
+def settle(port, rate):
+    port.flush()
+    port.baudrate = rate
+    time.sleep(0.01)
+
+
+def confirm(port):
+    return command(port, "*IDN?").startswith("PPCM")
+
+
+def switch(port, rate):
+    current = port.baudrate
+    if command(port, f"SYST:COMM:SER:BAUD {rate}") != "OK":
+        return False
+    settle(port, rate)
+    if confirm(port):
+        return True
+    time.sleep(CONFIRM_TIME)
+    settle(port, current)
+    return False
+
+
+def auto(port, rate):
+    current = port.baudrate
+    if command(port, "SYST:COMM:SER:AUTO") != "OK":
+        return False
+    settle(port, rate)
+    port.write(b"\x55")
+    time.sleep(0.01)
+    port.write(b"\r\n")
+    time.sleep(0.05)
+    port.reset_input_buffer()
+    if confirm(port):
+        return True
+    time.sleep(CONFIRM_TIME)
+    settle(port, current)
+    return False
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port")
+    parser.add_argument("--baud", type=int, default=19200, help="rate the link runs at now")
+    group = parser.add_mutually_exclusive_group()
+    group.add_argument("--rate", type=int, help="switch to this rate only")
+    group.add_argument("--auto", type=int, metavar="RATE", help="let the device detect this rate")
+    args = parser.parse_args()
+
+    with serial.Serial(args.port, args.baud, timeout=0.5) as port:
+        if not confirm(port):
+            sys.exit(f"no answer at {args.baud}")
+
+        if args.auto:
+            ok = auto(port, args.auto)
+        elif args.rate:
+            ok = switch(port, args.rate)
+        else:
+            reply = command(port, "SYST:COMM:SER:BAUD?").split(",")
+            fastest = int(reply[1]) if len(reply) == 2 else args.baud
+            ok = False
+            for rate in (r for r in STANDARD_RATES if args.baud < r <= fastest):
+                if switch(port, rate):
+                    ok = True
+                    break
+
+        print(f"link at {port.baudrate}" if ok else f"link stays at {port.baudrate}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,326 @@
+#!/usr/bin/env python3
+"""Decoder for the binary telemetry frames sent on the serial link.
+
+Wire format: COBS stuffed frames delimited by 0x00. Unstuffed, a frame is
+| type u8 | sequence u8 | payload | CRC32 u32 little endian |. The CRC is the
+STM32 CRC unit's CRC-32/MPEG-2 over type, sequence and payload read as little
+endian words, the last word zero padded.
+
+    telemetry.py /dev/ttyUSB0 --baud 19200        live from a port (needs pyserial)
+    telemetry.py capture.bin                      from a raw dump
+    telemetry.py capture.bin --csv capture.csv    also write the capture samples
+    telemetry.py /dev/ttyUSB0 --stream log.csv    append streamed samples
+    telemetry.py /dev/ttyUSB0 --elf ppcm.elf      print deferred log lines
+
+Log frames carry format string IDs instead of text. The IDs are addresses in
+the .log_strings section of the firmware ELF, which is never flashed, so the
+ELF the device runs is needed to print them.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MESSAGE_TYPES = {
+    0x01: "CaptureHeader",
+    0x02: "CaptureData",
+    0x10: "Stream",
+    0x20: "Log",
+}
+
+CAPTURE_MAGIC = 0x50414343
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def crc32_mpeg2(data):
+    padded = data + bytes(-len(data) % 4)
+    crc = 0xFFFFFFFF
+    for (word,) in struct.iter_unpack("<I", padded):
+        crc ^= word
+        for _ in range(32):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else (crc << 1)
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+class Decoder:
+    def __init__(self):
+        self.pending = bytearray()
+        self.expected = None
+        self.lost = 0
+        self.corrupt = 0
+
+    def feed(self, chunk):
+        self.pending += chunk
+        while True:
+            end = self.pending.find(0)
+            if end < 0:
+                return
+            stuffed = bytes(self.pending[:end])
+            del self.pending[:end + 1]
+            if stuffed:
+                frame = self.unpack(stuffed)
+                if frame is not None:
+                    yield frame
+
+    def unpack(self, stuffed):
+        raw = cobs_decode(stuffed)
+        if raw is None or len(raw) < 6:
+            self.corrupt += 1
+            return None
+        body, (crc,) = raw[:-4], struct.unpack("<I", raw[-4:])
+        if crc32_mpeg2(body) != crc:
+            self.corrupt += 1
+            return None
+        kind, sequence = body[0], body[1]
+        if self.expected is not None and sequence != self.expected:
+            self.lost += (sequence - self.expected) & 0xFF
+        self.expected = (sequence + 1) & 0xFF
+        return kind, sequence, body[2:]
+
+
+class CaptureAssembler:
+    def __init__(self):
+        self.header = None
+        self.data = bytearray()
+
+    def add(self, kind, payload):
+        if kind == 0x01:
+            magic, frames, trigger, fine_bits, rate = struct.unpack("<5I", payload[:20])
+            if magic != CAPTURE_MAGIC:
+                print(f"  unexpected capture magic {magic:#010x}", file=sys.stderr)
+            self.header = (frames, trigger, fine_bits, rate)
+            self.data = bytearray()
+        elif kind == 0x02 and self.header is not None:
+            self.data += payload
+        if self.header is not None and len(self.data) >= self.header[0] * 8:
+            return self.finish()
+        return None
+
+    def finish(self):
+        frames, trigger, fine_bits, rate = self.header
+        scale = float(1 << fine_bits)
+        samples = [(v / scale, i / scale) for v, i in struct.iter_unpack("<ii", self.data[:frames * 8])]
+        self.header = None
+        return trigger, rate, samples
+
+
+def stream_samples(payload):
+    """Stream frame: index u32, dropped u32, decimation u16, mode u8, fine bits u8, then voltage/current pairs."""
+    index, dropped, decimation, mode, fine_bits = struct.unpack("<IIHBB", payload[:12])
+    scale = float(1 << fine_bits)
+    samples = [(v / scale, i / scale) for v, i in struct.iter_unpack("<ii", payload[12:])]
+    return index, dropped, decimation, mode, samples
+
+
+class ElfImage:
+    """Log format strings and loaded data of an ELF file, by address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError(f"{path} is not an ELF file")
+        wide = data[4] == 2
+        if wide:
+            (shoff,) = struct.unpack_from("<Q", data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x3A)
+            layout = "<IIQQQQ"
+        else:
+            (shoff,) = struct.unpack_from("<I", data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+            layout = "<IIIIII"
+        headers = [struct.unpack_from(layout, data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx][4]
+
+        self.formats = []
+        self.loaded = []
+        for name, kind, flags, address, offset, size in headers:
+            name = data[names + name:data.index(b"\0", names + name)].decode()
+            if kind == 8:  # NOBITS
+                continue
+            content = data[offset:offset + size]
+            if name.startswith(".log_strings"):
+                self.formats.append((address, content))
+            elif flags & 0x2:  # ALLOC
+                self.loaded.append((address, content))
+
+    @staticmethod
+    def string(regions, address):
+        for start, content in regions:
+            if start <= address < start + len(content):
+                offset = address - start
+                return content[offset:content.index(b"\0", offset)].decode("ascii", "replace")
+        return None
+
+    def format(self, address):
+        return self.string(self.formats, address)
+
+    def text(self, address):
+        return self.string(self.loaded, address)
+
+
+CONVERSION = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diouxXcsfFeEgGp%])")
+
+
+def render(elf, fmt, args):
+    """printf on the host: every argument is one word, 64 bit integers two, floating point a float."""
+    args = list(args)
+
+    def take(count=1):
+        if len(args) < count:
+            raise IndexError
+        words = args[:count]
+        del args[:count]
+        return words[0] if count == 1 else words[0] | (words[1] << 32)
+
+    def replace(match):
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if width == "*":
+            width = str(struct.unpack("<i", struct.pack("<I", take()))[0])
+        if precision == "*":
+            precision = str(take())
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+        if conversion in "fFeEgG":
+            (value,) = struct.unpack("<f", struct.pack("<I", take()))
+            return (spec + conversion) % value
+        wide = length in ("ll", "j")
+        value = take(2 if wide else 1)
+        bits = 64 if wide else 32
+        if conversion in "di":
+            value -= (value >> (bits - 1)) << bits
+            return (spec + "d") % value
+        if conversion == "u":
+            return (spec + "d") % value
+        if conversion == "c":
+            return (spec + "c") % chr(value & 0xFF)
+        if conversion == "s":
+            return (spec + "s") % (elf.text(value) or f"<{value:#010x}>")
+        if conversion == "p":
+            return f"{value:#010x}"
+        return (spec + conversion) % value
+
+    try:
+        return CONVERSION.sub(replace, fmt)
+    except IndexError:
+        return fmt + " <missing arguments>"
+
+
+class LogPrinter:
+    """Log frame: dropped u32, core clock u32, then records of word count, format ID, cycle timestamp, arguments."""
+
+    def __init__(self, elf):
+        self.elf = elf
+        self.dropped = 0
+        self.previous = None
+        self.wraps = 0
+
+    def add(self, payload):
+        dropped, clock = struct.unpack("<II", payload[:8])
+        words = [w for (w,) in struct.iter_unpack("<I", payload[8:len(payload) - (len(payload) - 8) % 4])]
+        lines = []
+        if dropped != self.dropped:
+            lines.append(f"{'':>12} [{dropped - self.dropped} log records dropped]")
+            self.dropped = dropped
+
+        i = 0
+        while i + 3 <= len(words):
+            count, format_id, stamp = words[i:i + 3]
+            args = words[i + 3:i + 3 + count]
+            i += 3 + count
+
+            if self.previous is not None and stamp < self.previous:
+                self.wraps += 1
+            self.previous = stamp
+            seconds = ((self.wraps << 32) + stamp) / clock if clock else 0.0
+
+            fmt = self.elf.format(format_id) if self.elf else None
+            text = render(self.elf, fmt, args) if fmt is not None else f"<{format_id:#x}> " + " ".join(f"{a:#x}" for a in args)
+            lines.append(f"{seconds:12.6f} {text}")
+        return lines
+
+
+def chunks(source, baud):
+    if source == "-":
+        stream = sys.stdin.buffer
+    elif os.path.isfile(source):
+        stream = open(source, "rb")
+    else:
+        import serial
+        stream = serial.Serial(source, baud, timeout=0.1)
+    live = hasattr(stream, "in_waiting")
+    with stream:
+        while True:
+            chunk = stream.read(4096)
+            if chunk:
+                yield chunk
+            elif not live:
+                return
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="serial port, raw capture file or - for stdin")
+    parser.add_argument("--baud", type=int, default=19200)
+    parser.add_argument("--csv", help="write completed captures here")
+    parser.add_argument("--stream", help="append streamed samples here")
+    parser.add_argument("--elf", help="firmware image holding the log format strings")
+    parser.add_argument("--quiet", action="store_true", help="only report captures and errors")
+    args = parser.parse_args()
+
+    decoder = Decoder()
+    capture = CaptureAssembler()
+    log = LogPrinter(ElfImage(args.elf) if args.elf else None)
+
+    try:
+        for chunk in chunks(args.source, args.baud):
+            for kind, sequence, payload in decoder.feed(chunk):
+                if kind == 0x20:
+                    for line in log.add(payload):
+                        print(line)
+                    continue
+                if not args.quiet:
+                    print(f"{sequence:3d} {MESSAGE_TYPES.get(kind, hex(kind)):>14} {len(payload):4d} bytes")
+                if kind == 0x10:
+                    index, dropped, decimation, mode, samples = stream_samples(payload)
+                    if not args.quiet:
+                        print(f"    index {index} decimation {decimation} mode {mode} dropped {dropped}")
+                    if args.stream:
+                        with open(args.stream, "a") as out:
+                            for offset, (voltage, current) in enumerate(samples):
+                                out.write(f"{index + offset * decimation},{voltage:.3f},{current:.3f}\n")
+                    continue
+                done = capture.add(kind, payload)
+                if done is not None:
+                    trigger, rate, samples = done
+                    print(f"capture: {len(samples)} samples at {rate} Hz, trigger at {trigger}")
+                    if args.csv:
+                        with open(args.csv, "w") as out:
+                            out.write("index,time,voltage,current\n")
+                            for index, (voltage, current) in enumerate(samples):
+                                out.write(f"{index - trigger},{(index - trigger) / rate:.6f},{voltage:.3f},{current:.3f}\n")
+    except KeyboardInterrupt:
+        pass
+
+    print(f"lost {decoder.lost} frames, {decoder.corrupt} corrupt", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,101 @@
+#include "check.hpp"
+
+#include "common/command/dispatch.hpp"
+
+#include <array>
+#include <string_view>
+
+using namespace Common::Command;
+
+struct Reply {};
+
+template <int tId>
+void Handler(Arguments &, Reply &) {}
+
+using Entry = Command<Reply>;
+
+// The firmware's own command set, each pattern with a handler of its own
+constexpr std::array s_commands
+{
+    Entry{ "*IDN?", &Handler<0> },
+    Entry{ "SOURce:VOLTage", &Handler<1> },
+    Entry{ "SOURce:CURRent", &Handler<2> },
+    Entry{ "SOURce:GAIN", &Handler<3> },
+    Entry{ "OUTPut", &Handler<4> },
+    Entry{ "SENSe:MODE", &Handler<5> },
+    Entry{ "SENSe:MODE?", &Handler<6> },
+    Entry{ "MEASure?", &Handler<7> },
+    Entry{ "MEASure:VOLTage?", &Handler<8> },
+    Entry{ "MEASure:CURRent?", &Handler<9> },
+    Entry{ "CALCulate:STATistics?", &Handler<10> },
+    Entry{ "CALCulate:STATistics:RESet", &Handler<11> },
+    Entry{ "TRIGger", &Handler<12> },
+    Entry{ "TRIGger:ARM", &Handler<13> },
+    Entry{ "TRIGger:STATe?", &Handler<14> },
+    Entry{ "TRACe:DATA?", &Handler<15> },
+    Entry{ "STReam", &Handler<16> },
+    Entry{ "STReam?", &Handler<17> },
+    Entry{ "SYSTem:ERRor?", &Handler<18> },
+    Entry{ "SYSTem:MEMory?", &Handler<19> },
+    Entry{ "SYSTem:TIMing?", &Handler<20> },
+    Entry{ "SYSTem:COMMunicate:SERial:BAUD", &Handler<21> },
+    Entry{ "SYSTem:COMMunicate:SERial:BAUD?", &Handler<22> },
+    Entry{ "SYSTem:COMMunicate:SERial:AUTO", &Handler<23> }
+};
+
+using Table = HashTable<Reply, KeyCount(s_commands)>;
+
+constexpr Table s_table{ Table::Build(s_commands) };
+
+static_assert(s_table.Valid());
+
+// A short form that is not what the folding rule gives, and two patterns with the same short form
+static_assert(!HashTable<Reply, 1u>::Build(std::array{ Entry{ "STReaM", &Handler<0> } }).Valid());
+static_assert(!HashTable<Reply, 2u>::Build(std::array{ Entry{ "VOLTage", &Handler<0> }, Entry{ "VOLT", &Handler<1> } }).Valid());
+
+Table::Handler Find(std::string_view const name)
+{
+    return s_table.Find(Token{ name.data(), name.size() });
+}
+
+int main()
+{
+    // Every pattern in all-short and all-long form lands on its own handler, so no two share a slot
+    for (Entry const & entry : s_commands)
+    {
+        std::array<char, 64> shortened{};
+        size_t length{ 0 };
+        for (char const c : entry.Pattern)
+        {
+            if ((c < 'a') || (c > 'z')) { shortened[length++] = c; }
+        }
+
+        CHECK(Find(entry.Pattern) == entry.Function);
+        CHECK(Find(std::string_view{ shortened.data(), length }) == entry.Function);
+    }
+
+    // Each node takes its short or long form independently, in any case
+    CHECK(Find("SOUR:VOLTage") == &Handler<1>);
+    CHECK(Find("SOURce:VOLT") == &Handler<1>);
+    CHECK(Find("source:volt") == &Handler<1>);
+    CHECK(Find("sOuRcE:VoLtAgE") == &Handler<1>);
+    CHECK(Find("SYST:COMMUNICATE:ser:BAUD?") == &Handler<22>);
+    CHECK(Find("calc:statistics:res") == &Handler<11>);
+    CHECK(Find("stream?") == &Handler<17>);
+    CHECK(Find("*idn?") == &Handler<0>);
+
+    // Anything between the two forms, extra or missing nodes and query mix-ups are unknown
+    CHECK(Find("SOURC:VOLT") == nullptr);
+    CHECK(Find("SOUR:VOL") == nullptr);
+    CHECK(Find("SOURCES:VOLT") == nullptr);
+    CHECK(Find("STREAMS") == nullptr);
+    CHECK(Find("STRE") == nullptr);
+    CHECK(Find("SOUR") == nullptr);
+    CHECK(Find("SOUR:VOLT:LEV") == nullptr);
+    CHECK(Find("SOUR:VOLT?") == nullptr);
+    CHECK(Find("OUTP?") == nullptr);
+    CHECK(Find("SOUR:") == nullptr);
+    CHECK(Find(":") == nullptr);
+    CHECK(Find("") == nullptr);
+    return 0;
+}
\ No newline at end of file
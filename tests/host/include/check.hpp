@@ -0,0 +1,7 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+// Minimal assertion for the host tests, reports where it failed and ends the test with a failure
+#define CHECK(condition) do { if (!(condition)) { std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); std::exit(EXIT_FAILURE); } } while (false)
\ No newline at end of file
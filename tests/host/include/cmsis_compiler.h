@@ -0,0 +1,32 @@
+#pragma once
+
+// Host stand-ins for the CMSIS intrinsics the libraries use. There are no interrupts to mask and the exclusive
+// monitor becomes a compare-exchange on the word, so a store fails if another thread got in between.
+
+#include <atomic>
+#include <cstdint>
+
+inline thread_local uint32_t t_exclusive{ 0 };
+
+inline uint32_t __LDREXW(uint32_t volatile * const address)
+{
+    t_exclusive = std::atomic_ref<uint32_t>{ *const_cast<uint32_t *>(address) }.load();
+    return t_exclusive;
+}
+inline uint32_t __STREXW(uint32_t const value, uint32_t volatile * const address)
+{
+    uint32_t expected{ t_exclusive };
+    return std::atomic_ref<uint32_t>{ *const_cast<uint32_t *>(address) }.compare_exchange_strong(expected, value) ? 0u : 1u;
+}
+inline void __CLREX() {}
+inline void __DMB()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+inline uint32_t __get_PRIMASK()
+{
+    return 0u;
+}
+inline void __set_PRIMASK(uint32_t) {}
+inline void __disable_irq() {}
+inline void __enable_irq() {}
\ No newline at end of file
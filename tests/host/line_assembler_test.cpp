@@ -0,0 +1,58 @@
+#include "check.hpp"
+
+#include "common/command/line_assembler.hpp"
+
+#include <string>
+#include <string_view>
+
+using namespace Common::Command;
+
+using Assembler = LineAssembler<512u>;
+
+void Feed(Assembler & lines, std::string_view const text)
+{
+    // A few bytes at a time, the way the receive interrupt delivers them
+    for (size_t first{ 0 }; first < text.size(); first += 5u)
+    {
+        std::string_view const part{ text.substr(first, 5u) };
+        lines.Feed(Common::Containers::Span<char const>{ part.data(), part.size() });
+    }
+}
+
+std::string_view View(Assembler::Line line)
+{
+    return std::string_view{ line.data(), line.size() };
+}
+
+int main()
+{
+    Assembler lines{};
+
+    // Dozens of short commands on one line arrive whole
+    std::string many{};
+    for (unsigned i{ 0 }; i < 34u; ++i) { many += "SOUR:VOLT " + std::to_string(1000u + i) + ";"; }
+    Feed(lines, many + "\r\n");
+
+    auto line{ lines.Take() };
+    CHECK(line.has_value() && !lines.Truncated());
+    CHECK(View(line.value()) == many);
+    lines.Release();
+
+    // One that does not fit is still handed over, marked, and the next line is not affected
+    Feed(lines, std::string(600u, 'x') + "\nMEAS?\n");
+
+    line = lines.Take();
+    CHECK(line.has_value() && lines.Truncated() && (line.value().size() == 512u));
+    lines.Release();
+
+    line = lines.Take();
+    CHECK(line.has_value() && !lines.Truncated() && (View(line.value()) == "MEAS?"));
+    lines.Release();
+    CHECK(!lines.Take().has_value());
+
+    // With every slot waiting the line is dropped and counted
+    Feed(lines, "A\nB\nC\nD\n");
+    CHECK(lines.Dropped() == 1u);
+    CHECK(!lines.Ready());
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "check.hpp"
+
+#include "common/register.hpp"
+
+#include <cstdint>
+#include <sys/mman.h>
+
+using namespace Common;
+
+namespace
+{
+    // GPIOA ODR and CRL, with their bit-band alias words, backed by ordinary memory at the real addresses
+    constexpr uint32_t CRL{ 0x4001'0800u };
+    constexpr uint32_t ODR{ 0x4001'080Cu };
+
+    uint32_t volatile & Word(uint32_t const address)
+    {
+        return *reinterpret_cast<uint32_t volatile *>(static_cast<uintptr_t>(address));
+    }
+    bool Map(uint32_t const address, size_t const size)
+    {
+        void * const base{ reinterpret_cast<void *>(static_cast<uintptr_t>(address)) };
+        return (mmap(base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) == base);
+    }
+}
+
+int main()
+{
+    // Without the fixed mappings there is nothing to test against, the host does not allow them everywhere
+    if (!Map(CRL & ~0xFFFu, 0x1000u) || !Map(BitBand::Alias(CRL, 0u) & ~0xFFFu, 0x1000u)) { return 77; }
+
+    Bitfield<uint32_t, ODR, (1u << 5u)> od5{};
+    Bitfield<uint32_t, ODR, (1u << 6u)> od6{};
+    Bitfield<uint32_t, CRL, 0x00F0'0000u> mode5{};
+
+    // One bit of a register goes to its alias word and leaves the register itself alone
+    Word(ODR) = 0u;
+    WriteFields(od5.Value(1u));
+    CHECK(Word(BitBand::Alias(ODR, 5u)) == 1u);
+    CHECK(Word(ODR) == 0u);
+    WriteFields(mode5.Value(0x3u), od5.Value(0u));
+    CHECK(Word(BitBand::Alias(ODR, 5u)) == 0u);
+    CHECK(Word(CRL) == 0x0030'0000u);
+
+    // Two bits of the same register merge into one read-modify-write
+    Word(ODR) = 0x8001u;
+    WriteFields(od5.Value(1u), od6.Value(1u));
+    CHECK(Word(ODR) == 0x8061u);
+    WriteFields(od6.Value(0u), od5.Value(0u));
+    CHECK(Word(ODR) == 0x8001u);
+
+    // A later field on the same bits wins
+    WriteFields(mode5.Value(0x1u), mode5.Value(0x2u));
+    CHECK(Word(CRL) == 0x0020'0000u);
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include "check.hpp"
+
+#include "common/containers/ring_buffer.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <random>
+
+using namespace Common::Containers;
+
+// Contents and size against a deque after every step
+template <typename tRing>
+void Compare(tRing & ring, std::deque<uint32_t> const & reference)
+{
+    CHECK(ring.Size() == reference.size());
+    CHECK(ring.Available() == (ring.Capacity() - reference.size()));
+    CHECK(ring.Empty() == reference.empty());
+    for (size_t i{ 0 }; i < reference.size(); ++i) { CHECK(ring[i] == reference[i]); }
+}
+
+// The writable region and the one after it together cover exactly the free space, the readable ones the contents
+template <typename tRing>
+void CheckRegions(tRing & ring)
+{
+    size_t const writable{ ring.WritableRegion().size() };
+    size_t const readable{ ring.ReadableRegion().size() };
+
+    CHECK((writable != 0u) || ring.Full());
+    CHECK((readable != 0u) || ring.Empty());
+
+    tRing written{ ring };
+    written.CommitWrite(writable);
+    CHECK((writable + written.WritableRegion().size()) == ring.Available());
+
+    tRing read{ ring };
+    read.ConsumeRead(readable);
+    CHECK((readable + read.ReadableRegion().size()) == ring.Size());
+}
+
+template <size_t N>
+void Randomised(uint32_t const seed, size_t const steps)
+{
+    RingBuffer<uint32_t, N> ring{};
+    std::deque<uint32_t> reference{};
+    std::mt19937 generator{ seed };
+    uint32_t next{ 0 };
+
+    // Empty with the read index at zero, the region has to stop one short of the storage end
+    CHECK(ring.WritableRegion().size() == N);
+
+    for (size_t step{ 0 }; step < steps; ++step)
+    {
+        switch (generator() % 4u)
+        {
+            case 0u:
+            {
+                // Overwrites the oldest element once full
+                ring.Push(next);
+                reference.push_back(next++);
+                if (reference.size() > N) { reference.pop_front(); }
+                break;
+            }
+            case 1u:
+            {
+                auto const value{ ring.Pop() };
+                CHECK(value.has_value() == !reference.empty());
+                if (value.has_value())
+                {
+                    CHECK(value.value() == reference.front());
+                    reference.pop_front();
+                }
+                break;
+            }
+            case 2u:
+            {
+                // Fill part of the region the way a DMA transfer that stopped early would, then commit that much
+                auto region{ ring.WritableRegion() };
+                size_t const count{ region.empty() ? 0u : (generator() % (region.size() + 1u)) };
+                for (size_t i{ 0 }; i < count; ++i)
+                {
+                    region[i] = next;
+                    reference.push_back(next++);
+                }
+                ring.CommitWrite(count);
+                break;
+            }
+            default:
+            {
+                auto region{ ring.ReadableRegion() };
+                size_t const count{ region.empty() ? 0u : (generator() % (region.size() + 1u)) };
+                for (size_t i{ 0 }; i < count; ++i)
+                {
+                    CHECK(region[i] == reference.front());
+                    reference.pop_front();
+                }
+                ring.ConsumeRead(count);
+                break;
+            }
+        }
+
+        Compare(ring, reference);
+        CheckRegions(ring);
+    }
+}
+
+// Two rounds of region writes fill the ring completely whatever the indices, and two rounds of reads drain it
+template <size_t N>
+void TwoRounds()
+{
+    for (size_t offset{ 0 }; offset <= N; ++offset)
+    {
+        RingBuffer<uint32_t, N> ring{};
+        for (size_t i{ 0 }; i < offset; ++i) { ring.Push(0u); }
+        for (size_t i{ 0 }; i < offset; ++i) { (void)ring.Pop(); }
+
+        uint32_t value{ 0 };
+        for (unsigned round{ 0 }; round < 2u; ++round)
+        {
+            auto region{ ring.WritableRegion() };
+            for (size_t i{ 0 }; i < region.size(); ++i) { region[i] = value++; }
+            ring.CommitWrite(region.size());
+        }
+        CHECK(ring.Full() && (value == N));
+
+        uint32_t expected{ 0 };
+        for (unsigned round{ 0 }; round < 2u; ++round)
+        {
+            auto region{ ring.ReadableRegion() };
+            for (size_t i{ 0 }; i < region.size(); ++i) { CHECK(region[i] == expected++); }
+            ring.ConsumeRead(region.size());
+        }
+        CHECK(ring.Empty() && (expected == N));
+    }
+}
+
+int main()
+{
+    TwoRounds<1>();
+    TwoRounds<7>();
+    TwoRounds<16>();
+
+    Randomised<1>(1u, 10'000u);
+    Randomised<7>(2u, 100'000u);
+    Randomised<16>(3u, 100'000u);
+    return 0;
+}
\ No newline at end of file
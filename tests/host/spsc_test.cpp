@@ -0,0 +1,144 @@
+#include "check.hpp"
+
+#include "common/math.hpp"
+#include "common/containers/spsc_queue.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+using namespace Common::Containers;
+
+// Both halves of a slot are written together, a consumer that sees one without the other read a slot too early
+struct Item
+{
+    uint32_t Value{ 0 };
+    uint32_t Check{ 0 };
+};
+
+Item Make(uint32_t const value)
+{
+    return Item{ value, ~value * 2654435761u };
+}
+
+using Queue = SpscQueue<Item, 64u>;
+
+void Basics()
+{
+    Queue queue{};
+    CHECK(queue.Empty() && (queue.Available() == Queue::Capacity()));
+
+    for (uint32_t i{ 0 }; i < Queue::Capacity(); ++i) { CHECK(queue.TryPush(Make(i))); }
+    CHECK(queue.Full() && !queue.TryPush(Make(0u)));
+
+    for (uint32_t i{ 0 }; i < 10u; ++i) { CHECK(queue.TryPop().value().Value == i); }
+
+    // Partial writes take what fits and wrap around the end of the buffer
+    std::array<Item, 16u> input{};
+    for (uint32_t i{ 0 }; i < input.size(); ++i) { input[i] = Make(Queue::Capacity() + i); }
+    CHECK(queue.Write(Span<Item const>{ input.data(), input.size() }) == 10u);
+    CHECK(queue.Full());
+
+    std::array<Item, 100u> output{};
+    CHECK(queue.Read(Span<Item>{ output.data(), output.size() }) == Queue::Capacity());
+    for (uint32_t i{ 0 }; i < Queue::Capacity(); ++i) { CHECK(output[i].Value == (10u + i)); }
+    CHECK(queue.Empty() && !queue.TryPop().has_value());
+}
+
+// Producer and consumer on their own threads, each alternating single and block operations of varying size. A side
+// that finds the queue full or empty yields, so the test also finishes on a single core.
+double Stress(uint32_t const count)
+{
+    Queue queue{};
+
+    auto const start{ std::chrono::steady_clock::now() };
+
+    std::thread producer{ [&queue, count]()
+    {
+        uint32_t next{ 0 };
+        while (next < count)
+        {
+            if ((next & 1u) != 0u)
+            {
+                if (queue.TryPush(Make(next))) { ++next; }
+                else { std::this_thread::yield(); }
+                continue;
+            }
+
+            std::array<Item, 7u> block{};
+            uint32_t const size{ std::min<uint32_t>(1u + (next % block.size()), count - next) };
+            for (uint32_t i{ 0 }; i < size; ++i) { block[i] = Make(next + i); }
+            uint32_t const written{ static_cast<uint32_t>(queue.Write(Span<Item const>{ block.data(), size })) };
+            if (written == 0u) { std::this_thread::yield(); }
+            next += written;
+        }
+    } };
+
+    uint32_t expected{ 0 };
+    uint32_t errors{ 0 };
+    while (expected < count)
+    {
+        std::array<Item, 5u> block{};
+        size_t const size{ ((expected % 3u) == 0u) ? queue.Read(Span<Item>{ block.data(), 1u + (expected % block.size()) }) : 0u };
+        if (size == 0u)
+        {
+            auto const item{ queue.TryPop() };
+            if (!item.has_value())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            block[0] = item.value();
+        }
+
+        for (size_t i{ 0 }; i < Common::Math::Maximum(size, size_t{ 1u }); ++i)
+        {
+            Item const want{ Make(expected++) };
+            errors += ((block[i].Value != want.Value) || (block[i].Check != want.Check)) ? 1u : 0u;
+        }
+    }
+
+    producer.join();
+    CHECK(errors == 0u);
+    CHECK(queue.Empty());
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()) / count;
+}
+
+// One thread, a block in and out per pass, the cost of the queue without any contention
+double Throughput(uint32_t const count)
+{
+    constexpr size_t BlockSize{ 16u };
+
+    Queue queue{};
+    std::array<Item, BlockSize> block{};
+    uint32_t sum{ 0 };
+
+    auto const start{ std::chrono::steady_clock::now() };
+    for (uint32_t n{ 0 }; n < count; n += BlockSize)
+    {
+        block[0].Value = n;
+        queue.Write(Span<Item const>{ block.data(), BlockSize });
+        queue.Read(Span<Item>{ block.data(), BlockSize });
+        sum += block[0].Value;
+    }
+    auto const elapsed{ std::chrono::steady_clock::now() - start };
+
+    CHECK(sum != 1u);
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / count;
+}
+
+int main()
+{
+    Basics();
+
+    double const contended{ Stress(2'000'000u) };
+    double const uncontended{ Throughput(16'000'000u) };
+
+    std::printf("spsc, two threads: %.1f ns per item\n", contended);
+    std::printf("spsc, one thread, blocks of 16: %.2f ns per item\n", uncontended);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "check.hpp"
+
+#include "common/dsp/statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <random>
+
+using namespace Common::DSP;
+
+// Every output of the sliding extrema against a brute-force scan of the same window
+template <size_t tWindow, typename tSource>
+void CheckExtrema(size_t const count, tSource && source)
+{
+    SlidingExtrema<tWindow> extrema{};
+    std::deque<int32_t> window{};
+
+    for (size_t i{ 0 }; i < count; ++i)
+    {
+        int32_t const value{ source(i) };
+        extrema.Push(value);
+        window.push_back(value);
+        if (window.size() > tWindow) { window.pop_front(); }
+
+        CHECK(extrema.Minimum() == *std::min_element(window.begin(), window.end()));
+        CHECK(extrema.Maximum() == *std::max_element(window.begin(), window.end()));
+    }
+}
+
+int main()
+{
+    // A rising ramp keeps every sample in the minimum queue, so it is full when the oldest one has to age out
+    CheckExtrema<4>(12u, [](size_t const i) { return static_cast<int32_t>(i); });
+    CheckExtrema<4>(12u, [](size_t const i) { return -static_cast<int32_t>(i); });
+    CheckExtrema<1>(8u, [](size_t const i) { return static_cast<int32_t>(i * 7u % 5u); });
+
+    std::mt19937 generator{ 1u };
+    CheckExtrema<64>(100000u, [&](size_t) { return static_cast<int32_t>(generator() % (1u << 24u)) - (1 << 23); });
+    CheckExtrema<16>(10000u, [&](size_t) { return static_cast<int32_t>(generator() % 8u); });
+
+    // RMS over the window against the same window in double
+    SlidingRMS<64> rms{};
+    std::deque<int32_t> window{};
+    for (size_t i{ 0 }; i < 10000u; ++i)
+    {
+        int32_t const value{ static_cast<int32_t>(generator() % 20000u) - 10000 };
+        rms.Push(value);
+        window.push_back(value);
+        if (window.size() > 64u) { window.pop_front(); }
+    }
+    double squares{ 0.0 };
+    for (int32_t const value : window) { squares += double(value) * value; }
+    CHECK(std::abs(double(rms.RMS()) - std::sqrt(squares / 64.0)) <= 1.0);
+
+    // Welford on a constant offset with small noise
+    Welford<> welford{};
+    for (size_t i{ 0 }; i < 50000u; ++i) { welford.Push(8000 + static_cast<int32_t>(generator() % 1001u) - 500); }
+    CHECK(std::abs(welford.Mean() - 8000) <= 8);
+    CHECK(std::abs(double(welford.Variance()) - (1001.0 * 1001.0 - 1.0) / 12.0) <= 3000.0);
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file